@@ -42,6 +42,7 @@ Napi::Object initModule(Napi::Env env, Napi::Object exports) {
   EXPORT_FUNC(env, exports, "init", nv::cuInit);
   EXPORT_FUNC(env, exports, "getDriverVersion", nv::cuDriverGetVersion);
 
+  auto event   = Napi::Object::New(env);
   auto gl      = Napi::Object::New(env);
   auto kernel  = Napi::Object::New(env);
   auto math    = Napi::Object::New(env);
@@ -49,6 +50,7 @@ Napi::Object initModule(Napi::Env env, Napi::Object exports) {
   auto program = Napi::Object::New(env);
   auto stream  = Napi::Object::New(env);
 
+  EXPORT_PROP(exports, "event", event);
   EXPORT_PROP(exports, "gl", gl);
   EXPORT_PROP(exports, "kernel", kernel);
   EXPORT_PROP(exports, "math", math);
@@ -57,6 +59,7 @@ Napi::Object initModule(Napi::Env env, Napi::Object exports) {
   EXPORT_PROP(exports, "stream", stream);
   EXPORT_PROP(exports, "texture", stream);
 
+  nv::event::initModule(env, event);
   nv::gl::initModule(env, gl);
   nv::kernel::initModule(env, kernel);
   nv::math::initModule(env, math);
@@ -23,6 +23,7 @@ export default CUDA;
 export type CUdevice           = number;
 export type CUresult           = number;
 export type CUstream           = number;
+export type CUevent            = number;
 export type CUcontext          = Record<string, unknown>;
 export type CUfunction         = Record<string, unknown>;
 export type CUgraphicsResource = number;
@@ -73,10 +74,54 @@ export interface CUDA {
         };
     };
 
+  readonly stream: {
+    create(): CUstream;
+    createWithPriority(priority: number, flags?: number): CUstream;
+    getPriorityRange(): {least: number, greatest: number};
+    destroy(stream: CUstream): void;
+    query(stream: CUstream): boolean;
+    waitEvent(stream: CUstream, event: CUevent): void;
+    synchronize(stream: CUstream): void;
+    synchronizeAsync(stream: CUstream): Promise<void>;
+  };
+
+  readonly event: {
+    create(flags?: number): CUevent;
+    destroy(event: CUevent): void;
+    record(event: CUevent, stream?: CUstream): void;
+    query(event: CUevent): boolean;
+    synchronize(event: CUevent): void;
+    elapsedTime(start: CUevent, end: CUevent): number;
+    completed(event: CUevent): Promise<void>;
+
+    readonly flags: {
+      readonly default: number;
+      readonly blockingSync: number;
+      readonly disableTiming: number;
+      readonly interprocess: number;
+    };
+  };
+
   readonly runtime: {
     cudaMemGetInfo(): {free: number, total: number};
     cudaMemset(target: MemoryData, value: number, count: number, stream?: number) : void;
     cudaMemcpy(target: MemoryData, source: MemoryData, count: number, stream?: number) : void;
+    /**
+     * Enqueue a memset on `stream` (default: the legacy default stream). The returned Promise
+     * resolves once the stream has executed it; `target` is kept alive until then.
+     */
+    cudaMemsetAsync(target: MemoryData, value: number, count: number, stream?: number):
+      Promise<void>;
+    /**
+     * Enqueue a copy on `stream` (default: the legacy default stream). The returned Promise
+     * resolves once the stream has executed it; `target` and `source` are kept alive until then.
+     * Host memory should be pinned for the copy to be truly asynchronous.
+     */
+    cudaMemcpyAsync(target: MemoryData, source: MemoryData, count: number, stream?: number):
+      Promise<void>;
+    cudaMemcpyBatch(buffers: MemoryData[], descriptors: Float64Array, stream?: number): void;
+    cudaMemcpyBatchAsync(buffers: MemoryData[], descriptors: Float64Array, stream?: number):
+      Promise<void>;
   }
 
   readonly DeviceFlags: {
@@ -25,7 +25,7 @@ import {
   isNumber
 } from './util';
 
-const {runtime: {cudaMemcpy}} = CUDA;
+const {runtime: {cudaMemcpy, cudaMemcpyBatch, cudaMemcpyBatchAsync}} = CUDA;
 
 /** @ignore */
 // clang-format off
@@ -54,10 +54,71 @@ type MemoryViewConstructor<T extends TypedArray|BigIntArray> = {
 
 let allocateMemory = (byteLength: number): Memory => new DeviceMemory(byteLength);
 
+/**
+ * @summary Set the function MemoryViews use to allocate memory, e.g. to use pooled pinned host
+ * memory for staging buffers:
+ * ```typescript
+ * setDefaultAllocator((byteLength) => new PinnedMemory(byteLength));
+ * ```
+ */
 export function setDefaultAllocator(allocate: (byteLength: number) => Memory) {
   allocateMemory = allocate;
 }
 
+/**
+ * @summary One range of a {@link memcpyBatch `memcpyBatch`} call. Offsets and lengths are in
+ * bytes, relative to the start of `dst` and `src`.
+ */
+export interface MemcpyBatchRange {
+  dst: MemoryData;
+  dstOffset?: number;
+  src: MemoryData;
+  srcOffset?: number;
+  length: number;
+}
+
+/** @internal */
+function packMemcpyBatch(ranges: MemcpyBatchRange[]) {
+  const buffers: MemoryData[] = [];
+  const indices               = new Map<MemoryData, number>();
+  const descriptors           = new Float64Array(ranges.length * 5);
+  const indexOf               = (x: MemoryData) => {
+    let i = indices.get(x);
+    if (i === undefined) { indices.set(x, i = buffers.push(x) - 1); }
+    return i;
+  };
+  ranges.forEach(({dst, dstOffset = 0, src, srcOffset = 0, length}, i) => {
+    descriptors.set([indexOf(dst), dstOffset, indexOf(src), srcOffset, length], i * 5);
+  });
+  return [buffers, descriptors] as const;
+}
+
+/**
+ * @summary Copy many ranges between CUDA and/or host memory in a single native call. Ranges that
+ * continue the previous range in both `dst` and `src` are coalesced into one copy. Ranges are
+ * issued in the order given.
+ * @param ranges The ranges to copy.
+ * @param stream If provided, the copies are enqueued on this stream and the call returns
+ *   without waiting. Otherwise the copies complete before the call returns.
+ */
+export function memcpyBatch(ranges: MemcpyBatchRange[], stream?: number) {
+  const [buffers, descriptors] = packMemcpyBatch(ranges);
+  if (stream === undefined) {
+    cudaMemcpyBatch(buffers, descriptors);
+  } else {
+    cudaMemcpyBatch(buffers, descriptors, stream);
+  }
+}
+
+/**
+ * @summary Like {@link memcpyBatch `memcpyBatch`}, but returns a Promise that resolves once
+ * `stream` has executed every copy, without blocking the JS thread.
+ */
+export function memcpyBatchAsync(ranges: MemcpyBatchRange[], stream = 0) {
+  const [buffers, descriptors] = packMemcpyBatch(ranges);
+  return cudaMemcpyBatchAsync(buffers, descriptors, stream);
+}
+
 /**
  * @summary A base class for typed arrays of values in CUDA device memory.
  */
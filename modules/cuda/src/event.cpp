@@ -0,0 +1,119 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "node_cuda/task.hpp"
+#include "node_cuda/utilities/cpp_to_napi.hpp"
+#include "node_cuda/utilities/napi_to_cpp.hpp"
+
+#include <cuda_runtime_api.h>
+#include <nv_node/macros.hpp>
+#include <nv_node/utilities/args.hpp>
+
+namespace nv {
+
+// cudaError_t cudaEventCreateWithFlags(cudaEvent_t *event, unsigned int flags);
+Napi::Value cudaEventCreate(CallbackArgs const& info) {
+  auto env       = info.Env();
+  uint32_t flags = info.Length() > 0 ? info[0] : cudaEventDefault;
+  cudaEvent_t event;
+  NODE_CUDA_TRY(CUDARTAPI::cudaEventCreateWithFlags(&event, flags), env);
+  return CPPToNapi(info)(event);
+}
+
+// cudaError_t cudaEventDestroy(cudaEvent_t event);
+Napi::Value cudaEventDestroy(CallbackArgs const& info) {
+  auto env          = info.Env();
+  cudaEvent_t event = info[0];
+  NODE_CUDA_TRY(CUDARTAPI::cudaEventDestroy(event), env);
+  return env.Undefined();
+}
+
+// cudaError_t cudaEventRecord(cudaEvent_t event, cudaStream_t stream);
+Napi::Value cudaEventRecord(CallbackArgs const& info) {
+  auto env            = info.Env();
+  cudaEvent_t event   = info[0];
+  cudaStream_t stream = info.Length() > 1 ? info[1] : nullptr;
+  NODE_CUDA_TRY(CUDARTAPI::cudaEventRecord(event, stream), env);
+  return env.Undefined();
+}
+
+// cudaError_t cudaEventQuery(cudaEvent_t event);
+Napi::Value cudaEventQuery(CallbackArgs const& info) {
+  auto env          = info.Env();
+  cudaEvent_t event = info[0];
+  auto const status = CUDARTAPI::cudaEventQuery(event);
+  if (status == cudaErrorNotReady) { return CPPToNapi(info)(false); }
+  NODE_CUDA_TRY(status, env);
+  return CPPToNapi(info)(true);
+}
+
+// cudaError_t cudaEventSynchronize(cudaEvent_t event);
+Napi::Value cudaEventSynchronize(CallbackArgs const& info) {
+  auto env          = info.Env();
+  cudaEvent_t event = info[0];
+  NODE_CUDA_TRY(CUDARTAPI::cudaEventSynchronize(event), env);
+  return env.Undefined();
+}
+
+// cudaError_t cudaEventElapsedTime(float *ms, cudaEvent_t start, cudaEvent_t end);
+Napi::Value cudaEventElapsedTime(CallbackArgs const& info) {
+  auto env          = info.Env();
+  cudaEvent_t start = info[0];
+  cudaEvent_t end   = info[1];
+  float ms{};
+  NODE_CUDA_TRY(CUDARTAPI::cudaEventElapsedTime(&ms, start, end), env);
+  return CPPToNapi(info)(ms);
+}
+
+// Resolves once the work captured by the event's most recent record has completed. The wait
+// happens on a private non-blocking stream, so neither the JS thread nor the recording stream
+// is blocked. Destroying the private stream is deferred by the driver until its work is done.
+Napi::Value cudaEventCompleted(CallbackArgs const& info) {
+  cudaEvent_t event = info[0];
+  auto task         = new StreamOrderedTask(info.Env());
+  auto promise      = task->Promise();
+  cudaStream_t waiter{nullptr};
+  auto status = CUDARTAPI::cudaStreamCreateWithFlags(&waiter, cudaStreamNonBlocking);
+  if (status == cudaSuccess) { status = CUDARTAPI::cudaStreamWaitEvent(waiter, event, 0); }
+  if (status == cudaSuccess) {
+    task->Enqueue(waiter);
+  } else {
+    task->Reject(status);
+  }
+  if (waiter != nullptr) { CUDARTAPI::cudaStreamDestroy(waiter); }
+  return promise;
+}
+
+namespace event {
+Napi::Object initModule(Napi::Env env, Napi::Object exports) {
+  EXPORT_FUNC(env, exports, "create", nv::cudaEventCreate);
+  EXPORT_FUNC(env, exports, "destroy", nv::cudaEventDestroy);
+  EXPORT_FUNC(env, exports, "record", nv::cudaEventRecord);
+  EXPORT_FUNC(env, exports, "query", nv::cudaEventQuery);
+  EXPORT_FUNC(env, exports, "synchronize", nv::cudaEventSynchronize);
+  EXPORT_FUNC(env, exports, "elapsedTime", nv::cudaEventElapsedTime);
+  EXPORT_FUNC(env, exports, "completed", nv::cudaEventCompleted);
+
+  auto flags = Napi::Object::New(env);
+  EXPORT_ENUM(env, flags, "default", cudaEventDefault);
+  EXPORT_ENUM(env, flags, "blockingSync", cudaEventBlockingSync);
+  EXPORT_ENUM(env, flags, "disableTiming", cudaEventDisableTiming);
+  EXPORT_ENUM(env, flags, "interprocess", cudaEventInterprocess);
+  EXPORT_PROP(exports, "flags", flags);
+
+  return exports;
+}
+}  // namespace event
+
+}  // namespace nv
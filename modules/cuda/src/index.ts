@@ -17,4 +17,5 @@ export * from './addon';
 export * from './buffer';
 export * from './device';
 export * from './memory';
+export * from './stream';
 export * from './interfaces';
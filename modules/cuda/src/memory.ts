@@ -33,9 +33,43 @@ export interface DeviceMemory extends Memory {
 // eslint-disable-next-line @typescript-eslint/no-redeclare
 export const DeviceMemory: DeviceMemoryConstructor = CUDA.DeviceMemory;
 
+export interface PinnedMemoryPoolStatistics {
+  /** The number of allocations served from a cached block. */
+  hits: number;
+  /** The number of allocations that pinned new memory. */
+  misses: number;
+  /** Pinned bytes in blocks held by live PinnedMemory instances. */
+  usedBytes: number;
+  /** Pinned bytes in blocks cached for reuse, including blocks waiting for the device to finish. */
+  cachedBytes: number;
+  /** Pinned bytes (used plus cached) above which freed blocks are released, not cached. */
+  maxPinnedBytes: number;
+}
+
 export interface PinnedMemoryConstructor {
   readonly prototype: PinnedMemory;
+  /**
+   * Allocate pinned host memory.
+   *
+   * Allocations are rounded up to a power of two (minimum 4KiB) and served from a process-wide
+   * pool of pinned blocks, which are returned to the pool when the PinnedMemory is garbage
+   * collected. Allocations larger than 256MiB bypass the pool.
+   */
   new(byteLength?: number): PinnedMemory;
+  /**
+   * Returns the pinned memory pool's hit/miss counts and byte totals.
+   */
+  poolStatistics(): PinnedMemoryPoolStatistics;
+  /**
+   * Release every cached pinned block.
+   * @returns the number of bytes released
+   */
+  trimPool(): number;
+  /**
+   * Set the number of pinned bytes (used plus cached) above which freed blocks are released
+   * instead of cached, and release cached blocks down to that limit. Defaults to 1GiB.
+   */
+  setMaxPinnedBytes(byteLength: number): void;
 }
 
 export interface PinnedMemory extends Memory {
@@ -61,12 +95,31 @@ export const ManagedMemory: ManagedMemoryConstructor = CUDA.ManagedMemory;
 
 export interface IpcMemoryConstructor {
   readonly prototype: IpcMemory;
+  /**
+   * Map device memory exported by another process.
+   *
+   * Handles are opened through a process-wide, ref-counted cache, so opening a handle that's
+   * already open in this process returns the existing mapping. The mapping is closed when the last
+   * IpcMemory (or view) of it is closed or garbage collected.
+   */
   new(ipcHandle: Uint8Array): IpcMemory;
 }
 
 export interface IpcMemory extends Memory {
   readonly[Symbol.toStringTag]: 'IpcMemory';
+  /**
+   * Copy a range of the mapped memory into a new DeviceMemory.
+   */
   slice(start?: number, end?: number): DeviceMemory;
+  /**
+   * Create an IpcMemory that views a range of the mapped memory without copying. The view keeps
+   * the mapping open until it is closed or garbage collected.
+   */
+  view(start?: number, end?: number): IpcMemory;
+  /**
+   * Release this instance's reference to the mapping.
+   */
+  close(): void;
 }
 
 // eslint-disable-next-line @typescript-eslint/no-redeclare
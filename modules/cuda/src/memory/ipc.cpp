@@ -15,8 +15,74 @@
 #include "node_cuda/memory.hpp"
 #include "node_cuda/utilities/napi_to_cpp.hpp"
 
+#include <map>
+#include <mutex>
+#include <string>
+
 namespace nv {
 
+namespace {
+
+/**
+ * @brief A process-wide, ref-counted cache of opened IPC mappings, keyed by the handle's bytes.
+ *
+ * `cudaIpcOpenMemHandle` is slow, and fails if a handle is already open in this process.
+ */
+class ipc_mapping_cache {
+ public:
+  static ipc_mapping_cache& get() {
+    static ipc_mapping_cache cache;
+    return cache;
+  }
+
+  /**
+   * @brief Open `handle`, or add a reference to its existing mapping.
+   *
+   * @return The base pointer of the mapping.
+   */
+  void* open(Napi::Env const& env, cudaIpcMemHandle_t const& handle) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    auto& mapping = mappings_[key(handle)];
+    if (mapping.refs == 0) {
+      auto const status =
+        cudaIpcOpenMemHandle(&mapping.ptr, handle, cudaIpcMemLazyEnablePeerAccess);
+      if (status != cudaSuccess) {
+        mappings_.erase(key(handle));
+        NODE_CUDA_THROW(status, env);
+      }
+    }
+    ++mapping.refs;
+    return mapping.ptr;
+  }
+
+  /**
+   * @brief Remove a reference to the mapping of `handle`, closing it if it was the last one.
+   */
+  void close(cudaIpcMemHandle_t const& handle) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    auto mapping = mappings_.find(key(handle));
+    if (mapping != mappings_.end() && --mapping->second.refs == 0) {
+      cudaIpcCloseMemHandle(mapping->second.ptr);
+      mappings_.erase(mapping);
+    }
+  }
+
+ private:
+  struct mapping {
+    void* ptr{nullptr};
+    size_t refs{0};
+  };
+
+  static std::string key(cudaIpcMemHandle_t const& handle) {
+    return std::string(reinterpret_cast<char const*>(&handle), sizeof(handle));
+  }
+
+  std::mutex mtx_;
+  std::map<std::string, mapping> mappings_;
+};
+
+}  // namespace
+
 Napi::FunctionReference IpcMemory::constructor;
 
 Napi::Object IpcMemory::Init(Napi::Env env, Napi::Object exports) {
@@ -31,6 +97,7 @@ Napi::Object IpcMemory::Init(Napi::Env env, Napi::Object exports) {
                   InstanceAccessor("device", &IpcMemory::device, nullptr, napi_enumerable),
                   InstanceAccessor("ptr", &IpcMemory::ptr, nullptr, napi_enumerable),
                   InstanceMethod("slice", &IpcMemory::slice),
+                  InstanceMethod("view", &IpcMemory::view),
                   InstanceMethod("close", &IpcMemory::close),
                 });
   IpcMemory::constructor = Napi::Persistent(ctor);
@@ -52,7 +119,8 @@ Napi::Object IpcMemory::New(cudaIpcMemHandle_t const& handle) {
 }
 
 void IpcMemory::Initialize(cudaIpcMemHandle_t const& handle) {
-  NODE_CUDA_TRY(cudaIpcOpenMemHandle(&data_, handle, cudaIpcMemLazyEnablePeerAccess), Env());
+  data_   = ipc_mapping_cache::get().open(Env(), handle);
+  handle_ = handle;
   NODE_CU_TRY(cuMemGetAddressRange(nullptr, &size_, ptr()), Env());
   Napi::MemoryManagement::AdjustExternalMemory(Env(), size_);
 }
@@ -62,10 +130,9 @@ void IpcMemory::Finalize(Napi::Env env) { close(env); }
 void IpcMemory::close() { close(Env()); }
 
 void IpcMemory::close(Napi::Env const& env) {
-  if (data_ != nullptr && size_ > 0) {
-    if (cudaIpcCloseMemHandle(data_) == cudaSuccess) {
-      Napi::MemoryManagement::AdjustExternalMemory(env, -size_);
-    }
+  if (data_ != nullptr) {
+    ipc_mapping_cache::get().close(handle_);
+    if (size_ > 0) { Napi::MemoryManagement::AdjustExternalMemory(env, -size_); }
   }
   data_ = nullptr;
   size_ = 0;
@@ -89,6 +156,22 @@ Napi::Value IpcMemory::slice(Napi::CallbackInfo const& info) {
   return copy;
 }
 
+Napi::Value IpcMemory::view(Napi::CallbackInfo const& info) {
+  CallbackArgs args{info};
+  NODE_CUDA_EXPECT(data_ != nullptr, "Cannot view a closed IpcMemory", args.Env());
+  int64_t lhs        = args.Length() > 0 ? args[0] : 0;
+  int64_t rhs        = args.Length() > 1 ? args[1] : size_;
+  std::tie(lhs, rhs) = clamp_slice_args(size_, lhs, rhs);
+  // Views hold their own reference to the mapping, so they can outlive this instance
+  auto inst = IpcMemory::New(handle_);
+  auto view = IpcMemory::Unwrap(inst);
+  Napi::MemoryManagement::AdjustExternalMemory(info.Env(),
+                                               (rhs - lhs) - static_cast<int64_t>(view->size_));
+  view->data_ = base() + lhs;
+  view->size_ = rhs - lhs;
+  return inst;
+}
+
 Napi::FunctionReference IpcHandle::constructor;
 
 Napi::Object IpcHandle::Init(Napi::Env env, Napi::Object exports) {
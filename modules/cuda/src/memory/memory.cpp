@@ -13,10 +13,15 @@
 // limitations under the License.
 
 #include "node_cuda/memory.hpp"
+#include "node_cuda/task.hpp"
 #include "node_cuda/utilities/napi_to_cpp.hpp"
 
 #include <nv_node/macros.hpp>
 
+#include <cmath>
+#include <tuple>
+#include <vector>
+
 namespace nv {
 
 namespace {
@@ -46,6 +51,113 @@ void cudaMemcpyNapi(CallbackArgs const& args) {
   }
 }
 
+// cudaError_t cudaMemsetAsync(void *devPtr, int value, size_t count, cudaStream_t stream);
+Napi::Value cudaMemsetAsyncNapi(CallbackArgs const& args) {
+  Span<char> target   = args[0];
+  int32_t value       = args[1];
+  size_t count        = args[2];
+  cudaStream_t stream = args.Length() > 3 ? args[3] : nullptr;
+  NODE_CUDA_TRY(cudaMemsetAsync(target.data(), value, count, stream), args.Env());
+  return (new StreamOrderedTask(args.Env(), {args[0]}))->Enqueue(stream);
+}
+
+// cudaError_t cudaMemcpyAsync(void *dst, const void *src, size_t count, cudaMemcpyKind kind,
+// cudaStream_t stream);
+Napi::Value cudaMemcpyAsyncNapi(CallbackArgs const& args) {
+  Span<char> target   = args[0];
+  Span<char> source   = args[1];
+  size_t count        = args[2];
+  cudaStream_t stream = args.Length() > 3 ? args[3] : nullptr;
+  NODE_CUDA_TRY(cudaMemcpyAsync(target.data(), source.data(), count, cudaMemcpyDefault, stream),
+                args.Env());
+  return (new StreamOrderedTask(args.Env(), {args[0], args[1]}))->Enqueue(stream);
+}
+
+// Issues the copies described by `descriptors` on `stream`. `buffers` holds each distinct source
+// and target, and `descriptors` is a packed array of (dstIndex, dstOffset, srcIndex, srcOffset,
+// byteLength) tuples. Every descriptor is validated before any copy is enqueued, so an invalid
+// batch throws without partially applying. Consecutive descriptors that continue the previous
+// copy in both buffers are coalesced into a single cudaMemcpyAsync. Descriptors are never
+// reordered, so copies to overlapping ranges still apply in the order given.
+void cudaMemcpyBatch(CallbackArgs const& args, cudaStream_t stream) {
+  auto env                         = args.Env();
+  auto buffers                     = args[0].val.As<Napi::Array>();
+  Span<double> descriptors         = args[1];
+  std::vector<Span<char>> memories = args[0];
+
+  NODE_CUDA_EXPECT(descriptors.size() % 5 == 0,
+                   "memcpyBatch expects descriptors packed as 5-tuples of "
+                   "(dstIndex, dstOffset, srcIndex, srcOffset, byteLength)",
+                   env);
+
+  auto is_size = [](double x) { return std::isfinite(x) && x >= 0 && std::floor(x) == x; };
+
+  // Raw pointers passed as numbers have no known size, so can't be bounds checked
+  std::vector<bool> unbounded(memories.size());
+  for (uint32_t i = 0; i < buffers.Length(); ++i) {
+    auto const buffer = buffers.Get(i);
+    unbounded[i]      = buffer.IsNumber() || buffer.IsBigInt();
+  }
+
+  auto check_range = [&](double index, double offset, double length) {
+    NODE_CUDA_EXPECT(is_size(index) && is_size(offset) && is_size(length),
+                     "memcpyBatch descriptors must be non-negative integers",
+                     env);
+    auto const i = static_cast<size_t>(index);
+    NODE_CUDA_EXPECT(i < memories.size(), "memcpyBatch buffer index out of range", env);
+    auto const size = memories[i].size();
+    NODE_CUDA_EXPECT(unbounded[i] || (offset <= size && length <= size - offset),
+                     "memcpyBatch range exceeds the bounds of its buffer",
+                     env);
+  };
+
+  for (size_t i = 0; i < descriptors.size(); i += 5) {
+    auto const* d = descriptors.data() + i;
+    check_range(d[0], d[1], d[4]);
+    check_range(d[2], d[3], d[4]);
+  }
+
+  auto span_at = [&](double index, double offset) {
+    return memories[static_cast<size_t>(index)].data() + static_cast<size_t>(offset);
+  };
+
+  char* dst{nullptr};
+  char const* src{nullptr};
+  size_t len{0};
+
+  for (size_t i = 0; i < descriptors.size(); i += 5) {
+    auto const* d  = descriptors.data() + i;
+    auto const n   = static_cast<size_t>(d[4]);
+    auto* next_dst = span_at(d[0], d[1]);
+    auto* next_src = span_at(d[2], d[3]);
+    if (n == 0) { continue; }
+    if (len > 0 && next_dst == dst + len && next_src == src + len) {
+      len += n;
+      continue;
+    }
+    if (len > 0) {
+      NODE_CUDA_TRY(cudaMemcpyAsync(dst, src, len, cudaMemcpyDefault, stream), env);
+    }
+    std::tie(dst, src, len) = std::make_tuple(next_dst, next_src, n);
+  }
+  if (len > 0) { NODE_CUDA_TRY(cudaMemcpyAsync(dst, src, len, cudaMemcpyDefault, stream), env); }
+}
+
+// Without a stream the batch is issued on the legacy default stream and waited on, mirroring
+// cudaMemcpy. With a stream it returns as soon as the copies are enqueued.
+void cudaMemcpyBatchNapi(CallbackArgs const& args) {
+  auto env            = args.Env();
+  cudaStream_t stream = args.Length() > 2 ? args[2] : nullptr;
+  cudaMemcpyBatch(args, stream);
+  if (args.Length() < 3) { NODE_CUDA_TRY(cudaStreamSynchronize(stream), env); }
+}
+
+Napi::Value cudaMemcpyBatchAsyncNapi(CallbackArgs const& args) {
+  cudaStream_t stream = args.Length() > 2 ? args[2] : nullptr;
+  cudaMemcpyBatch(args, stream);
+  return (new StreamOrderedTask(args.Env(), {args[0]}))->Enqueue(stream);
+}
+
 // CUresult cudaMemGetInfo(size_t * free, size_t * total);
 Napi::Value cudaMemGetInfoNapi(CallbackArgs const& args) {
   size_t free, total;
@@ -124,6 +236,10 @@ Napi::Object initModule(Napi::Env env,
 
   EXPORT_FUNC(env, runtime, "cudaMemset", cudaMemsetNapi);
   EXPORT_FUNC(env, runtime, "cudaMemcpy", cudaMemcpyNapi);
+  EXPORT_FUNC(env, runtime, "cudaMemsetAsync", cudaMemsetAsyncNapi);
+  EXPORT_FUNC(env, runtime, "cudaMemcpyAsync", cudaMemcpyAsyncNapi);
+  EXPORT_FUNC(env, runtime, "cudaMemcpyBatch", cudaMemcpyBatchNapi);
+  EXPORT_FUNC(env, runtime, "cudaMemcpyBatchAsync", cudaMemcpyBatchAsyncNapi);
   EXPORT_FUNC(env, runtime, "cudaMemGetInfo", cudaMemGetInfoNapi);
   EXPORT_FUNC(env, driver, "cuPointerGetAttribute", cuPointerGetAttributeNapi);
 
@@ -31,6 +31,9 @@ Napi::Object PinnedMemory::Init(Napi::Env env, Napi::Object exports) {
                   InstanceAccessor("device", &PinnedMemory::device, nullptr, napi_enumerable),
                   InstanceAccessor("ptr", &PinnedMemory::ptr, nullptr, napi_enumerable),
                   InstanceMethod("slice", &PinnedMemory::slice),
+                  StaticMethod("poolStatistics", &PinnedMemory::pool_statistics),
+                  StaticMethod("trimPool", &PinnedMemory::trim_pool),
+                  StaticMethod("setMaxPinnedBytes", &PinnedMemory::set_max_pinned_bytes),
                 });
   PinnedMemory::constructor = Napi::Persistent(ctor);
   PinnedMemory::constructor.SuppressDestruct();
@@ -58,21 +61,45 @@ Napi::Object PinnedMemory::New(size_t size) {
 void PinnedMemory::Initialize(size_t size) {
   size_ = size;
   if (size_ > 0) {
-    NODE_CUDA_TRY(cudaMallocHost(&data_, size_));
+    data_ = PinnedMemoryPool::get().allocate(size_);
     Napi::MemoryManagement::AdjustExternalMemory(Env(), size_);
   }
 }
 
 void PinnedMemory::Finalize(Napi::Env env) {
   if (data_ != nullptr && size_ > 0) {
-    if (cudaFreeHost(data_) == cudaSuccess) {
-      Napi::MemoryManagement::AdjustExternalMemory(env, -size_);
-    }
+    PinnedMemoryPool::get().deallocate(data_, size_);
+    Napi::MemoryManagement::AdjustExternalMemory(env, -size_);
   }
   data_ = nullptr;
   size_ = 0;
 }
 
+Napi::Value PinnedMemory::pool_statistics(Napi::CallbackInfo const& info) {
+  auto env   = info.Env();
+  auto stats = PinnedMemoryPool::get().get_statistics();
+  auto obj   = Napi::Object::New(env);
+  obj.Set("hits", Napi::Number::New(env, stats.hits));
+  obj.Set("misses", Napi::Number::New(env, stats.misses));
+  obj.Set("usedBytes", Napi::Number::New(env, stats.used_bytes));
+  obj.Set("cachedBytes", Napi::Number::New(env, stats.cached_bytes));
+  obj.Set("maxPinnedBytes", Napi::Number::New(env, stats.max_pinned_bytes));
+  return obj;
+}
+
+Napi::Value PinnedMemory::trim_pool(Napi::CallbackInfo const& info) {
+  return CPPToNapi(info)(PinnedMemoryPool::get().trim());
+}
+
+Napi::Value PinnedMemory::set_max_pinned_bytes(Napi::CallbackInfo const& info) {
+  CallbackArgs args{info};
+  NODE_CUDA_EXPECT(args.Length() == 1 && args[0].IsNumber(),
+                   "setMaxPinnedBytes requires a numeric byteLength argument",
+                   args.Env());
+  PinnedMemoryPool::get().set_max_pinned_bytes(args[0].operator size_t());
+  return info.Env().Undefined();
+}
+
 Napi::Value PinnedMemory::slice(Napi::CallbackInfo const& info) {
   CallbackArgs args{info};
   int64_t lhs        = args.Length() > 0 ? args[0] : 0;
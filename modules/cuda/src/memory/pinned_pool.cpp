@@ -0,0 +1,179 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "node_cuda/pinned_memory_pool.hpp"
+#include "node_cuda/utilities/error.hpp"
+
+#include <cuda.h>
+#include <cuda_runtime_api.h>
+
+namespace nv {
+
+namespace {
+
+// Pinned blocks aren't tied to a device, so a copy on any device may still be using one. Wait on
+// every device whose primary context is active, as cudaFreeHost does, without creating contexts
+// on the others. Returns the first error, after restoring the current device.
+cudaError_t synchronize_active_devices() {
+  int count{0}, current{0};
+  auto status = cudaGetDevice(&current);
+  if (status == cudaSuccess) { status = cudaGetDeviceCount(&count); }
+  if (status != cudaSuccess) { return status; }
+  for (int ordinal = 0; status == cudaSuccess && ordinal < count; ++ordinal) {
+    CUdevice device{};
+    unsigned int flags{0};
+    int active{1};  // If the state can't be queried, synchronize the device anyway
+    if (cuDeviceGet(&device, ordinal) == CUDA_SUCCESS) {
+      cuDevicePrimaryCtxGetState(device, &flags, &active);
+    }
+    if (!active) { continue; }
+    status = cudaSetDevice(ordinal);
+    if (status == cudaSuccess) { status = cudaDeviceSynchronize(); }
+  }
+  auto const restored = cudaSetDevice(current);
+  return status != cudaSuccess ? status : restored;
+}
+
+}  // namespace
+
+PinnedMemoryPool& PinnedMemoryPool::get() {
+  static PinnedMemoryPool pool;
+  return pool;
+}
+
+PinnedMemoryPool::PinnedMemoryPool()
+  : free_lists_(size_class(max_block_size) + 1), pending_lists_(size_class(max_block_size) + 1) {
+  stats_.max_pinned_bytes = std::size_t{1} << 30;
+}
+
+std::size_t PinnedMemoryPool::block_size(std::size_t size) {
+  if (size > max_block_size) { return size; }
+  std::size_t block = min_block_size;
+  while (block < size) { block <<= 1; }
+  return block;
+}
+
+std::size_t PinnedMemoryPool::size_class(std::size_t block_size) {
+  std::size_t idx = 0;
+  for (auto block = min_block_size; block < block_size; block <<= 1) { ++idx; }
+  return idx;
+}
+
+void* PinnedMemoryPool::allocate(std::size_t size) {
+  auto const block = block_size(size);
+  if (block <= max_block_size) {
+    std::unique_lock<std::mutex> lock(mtx_);
+    if (free_lists_[size_class(block)].empty() && !pending_lists_[size_class(block)].empty()) {
+      lock.unlock();
+      reclaim_pending();
+    }
+  }
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (block <= max_block_size) {
+      auto& free_list = free_lists_[size_class(block)];
+      if (!free_list.empty()) {
+        auto ptr = free_list.back();
+        free_list.pop_back();
+        stats_.cached_bytes -= block;
+        stats_.used_bytes += block;
+        ++stats_.hits;
+        return ptr;
+      }
+    }
+    ++stats_.misses;
+  }
+  void* ptr{nullptr};
+  auto status = cudaMallocHost(&ptr, block);
+  if (status != cudaSuccess) {
+    // Release cached blocks of other sizes and try again
+    cudaGetLastError();
+    trim();
+    NODE_CUDA_TRY(cudaMallocHost(&ptr, block));
+  }
+  std::lock_guard<std::mutex> lock(mtx_);
+  stats_.used_bytes += block;
+  return ptr;
+}
+
+void PinnedMemoryPool::deallocate(void* ptr, std::size_t size) {
+  auto const block = block_size(size);
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    stats_.used_bytes -= block;
+    if (block <= max_block_size &&
+        stats_.used_bytes + stats_.cached_bytes + block <= stats_.max_pinned_bytes) {
+      pending_lists_[size_class(block)].push_back(ptr);
+      stats_.cached_bytes += block;
+      return;
+    }
+  }
+  cudaFreeHost(ptr);
+}
+
+void PinnedMemoryPool::reclaim_pending() {
+  std::vector<std::vector<void*>> pending(pending_lists_.size());
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    pending.swap(pending_lists_);
+  }
+  // Wait for any copies still using the blocks, as cudaFreeHost would have
+  auto const status = synchronize_active_devices();
+  std::lock_guard<std::mutex> lock(mtx_);
+  for (std::size_t idx = 0; idx < pending.size(); ++idx) {
+    // If the sync failed, keep the blocks pending rather than reusing them unsynchronized
+    auto& to = status == cudaSuccess ? free_lists_[idx] : pending_lists_[idx];
+    to.insert(to.end(), pending[idx].begin(), pending[idx].end());
+  }
+  if (status != cudaSuccess) { NODE_CUDA_THROW(status); }
+}
+
+std::size_t PinnedMemoryPool::trim() { return trim_to(0); }
+
+void PinnedMemoryPool::set_max_pinned_bytes(std::size_t max_pinned_bytes) {
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    stats_.max_pinned_bytes = max_pinned_bytes;
+  }
+  trim_to(max_pinned_bytes);
+}
+
+std::size_t PinnedMemoryPool::trim_to(std::size_t max_pinned_bytes) {
+  std::vector<void*> blocks;
+  std::size_t freed{0};
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    // Free the largest blocks first. cudaFreeHost synchronizes, so pending blocks can be freed too.
+    for (auto idx = free_lists_.size(); idx-- > 0;) {
+      auto const block = min_block_size << idx;
+      for (auto* list : {&pending_lists_[idx], &free_lists_[idx]}) {
+        while (!list->empty() && stats_.used_bytes + stats_.cached_bytes > max_pinned_bytes) {
+          blocks.push_back(list->back());
+          list->pop_back();
+          stats_.cached_bytes -= block;
+          freed += block;
+        }
+      }
+    }
+  }
+  for (auto ptr : blocks) { cudaFreeHost(ptr); }
+  return freed;
+}
+
+PinnedMemoryPool::statistics PinnedMemoryPool::get_statistics() const {
+  std::lock_guard<std::mutex> lock(mtx_);
+  return stats_;
+}
+
+}  // namespace nv
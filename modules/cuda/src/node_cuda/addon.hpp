@@ -20,6 +20,10 @@
 
 namespace nv {
 
+namespace event {
+Napi::Object initModule(Napi::Env env, Napi::Object exports);
+}  // namespace event
+
 namespace gl {
 Napi::Object initModule(Napi::Env env, Napi::Object exports);
 }  // namespace gl
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include "node_cuda/pinned_memory_pool.hpp"
 #include "node_cuda/utilities/cpp_to_napi.hpp"
 
 #include <nv_node/utilities/args.hpp>
@@ -123,6 +124,10 @@ class PinnedMemory : public Napi::ObjectWrap<PinnedMemory>, public Memory {
  private:
   static Napi::FunctionReference constructor;
 
+  static Napi::Value pool_statistics(Napi::CallbackInfo const& info);
+  static Napi::Value trim_pool(Napi::CallbackInfo const& info);
+  static Napi::Value set_max_pinned_bytes(Napi::CallbackInfo const& info);
+
   Napi::Value slice(Napi::CallbackInfo const& info);
 };
 
@@ -289,7 +294,10 @@ class IpcMemory : public Napi::ObjectWrap<IpcMemory>, public Memory {
   /**
    * @brief Initialize the IPCMemory instance created by either C++ or JavaScript.
    *
-   * @param size Size in bytes to allocate in CUDA managed memory.
+   * Handles are opened through a process-wide cache, so IpcMemory instances for the same handle
+   * share one mapping. The mapping is closed when the last instance is closed or finalized.
+   *
+   * @param handle The IPC handle of the memory to map.
    */
   void Initialize(cudaIpcMemHandle_t const& handle);
 
@@ -312,7 +320,10 @@ class IpcMemory : public Napi::ObjectWrap<IpcMemory>, public Memory {
   static Napi::FunctionReference constructor;
 
   Napi::Value slice(Napi::CallbackInfo const& info);
+  Napi::Value view(Napi::CallbackInfo const& info);
   Napi::Value close(Napi::CallbackInfo const& info);
+
+  cudaIpcMemHandle_t handle_{};  ///< The handle of the mapping this instance holds open
 };
 
 class IpcHandle : public Napi::ObjectWrap<IpcHandle> {
@@ -0,0 +1,108 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+namespace nv {
+
+/**
+ * @brief A process-wide pool of pinned host memory blocks, binned by power-of-two size class.
+ *
+ * Pinning memory with `cudaMallocHost` is slow, so `PinnedMemory` allocates from this pool, and
+ * returns its block to the pool when it's garbage collected. Allocations larger than the largest
+ * size class bypass the pool.
+ *
+ * `cudaFreeHost` implicitly synchronizes every device, but returning a block to the pool doesn't,
+ * so an async copy may still be using a returned block. Returned blocks wait in a pending list
+ * until the pool needs them, and the pool synchronizes every device with an active context once
+ * before reusing any of them.
+ */
+class PinnedMemoryPool {
+ public:
+  static constexpr std::size_t min_block_size = 1 << 12;  ///< 4 KiB
+  static constexpr std::size_t max_block_size = 1 << 28;  ///< 256 MiB
+
+  struct statistics {
+    int64_t hits{0};                  ///< Allocations served from a cached block
+    int64_t misses{0};                ///< Allocations that called cudaMallocHost
+    std::size_t used_bytes{0};        ///< Pinned bytes in blocks currently allocated
+    std::size_t cached_bytes{0};      ///< Pinned bytes in blocks cached for reuse or pending
+    std::size_t max_pinned_bytes{0};  ///< Pinned bytes above which blocks aren't cached
+  };
+
+  /**
+   * @brief Returns the process-wide PinnedMemoryPool.
+   */
+  static PinnedMemoryPool& get();
+
+  /**
+   * @brief Allocate at least `size` bytes of pinned host memory.
+   *
+   * @param size The number of bytes to allocate.
+   * @return Pointer to the pinned block.
+   */
+  void* allocate(std::size_t size);
+
+  /**
+   * @brief Return a block from `allocate()` to the pool, or free it if the pool holds more than
+   * `max_pinned_bytes`.
+   *
+   * @param ptr Pointer returned by `allocate(size)`.
+   * @param size The size passed to `allocate()`.
+   */
+  void deallocate(void* ptr, std::size_t size);
+
+  /**
+   * @brief Free every cached block.
+   *
+   * @return The number of bytes freed.
+   */
+  std::size_t trim();
+
+  /**
+   * @brief Set the maximum number of pinned bytes (allocated plus cached) the pool may hold before
+   * it frees returned blocks instead of caching them. Trims cached blocks down to the new limit.
+   */
+  void set_max_pinned_bytes(std::size_t max_pinned_bytes);
+
+  statistics get_statistics() const;
+
+ private:
+  PinnedMemoryPool();
+
+  static std::size_t block_size(std::size_t size);
+  static std::size_t size_class(std::size_t block_size);
+
+  std::size_t trim_to(std::size_t max_pinned_bytes);
+
+  /**
+   * @brief Synchronize every device with an active context, then make every block pending before
+   * the call reusable.
+   */
+  void reclaim_pending();
+
+  mutable std::mutex mtx_;
+  statistics stats_{};
+  std::vector<std::vector<void*>> free_lists_;     ///< Reusable blocks of each size class
+  std::vector<std::vector<void*>> pending_lists_;  ///< Returned blocks of each size class the
+                                                   ///< device may still be using
+};
+
+}  // namespace nv
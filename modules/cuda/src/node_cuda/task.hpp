@@ -14,8 +14,15 @@
 
 #pragma once
 
+#include "node_cuda/utilities/error.hpp"
+
+#include <cuda_runtime_api.h>
 #include <napi.h>
 
+#include <atomic>
+#include <initializer_list>
+#include <vector>
+
 namespace nv {
 
 class Task : public Napi::AsyncWorker {
@@ -28,11 +35,12 @@ class Task : public Napi::AsyncWorker {
     return (new Task(value.Env()))->Resolve(value).Promise();
   }
 
-  // Safe to call from any thread
+  // Must be called on the JS thread. Queue() schedules work on the libuv loop, which isn't
+  // thread-safe. Work that completes on another thread settles through a ThreadSafeFunction.
   static inline void Notify(void* task) { Task::Notify(static_cast<Task*>(task)); }
 
   static inline void Notify(Task* task) {
-    if (!task->notified_ && (task->notified_ = true)) { task->Queue(); }
+    if (!task->notified_.exchange(true)) { task->Queue(); }
   }
 
   Task(Napi::Env env);
@@ -58,11 +66,60 @@ class Task : public Napi::AsyncWorker {
 
   bool settled_  = false;
   bool rejected_ = false;
-  bool notified_ = false;
+  std::atomic<bool> notified_{false};
 
   Napi::Value val_;
   Napi::Reference<Napi::Value> ref_;
   Napi::Promise::Deferred deferred_;
 };
 
+// Settles its promise once the stream reaches the point at which the task was enqueued. Holds
+// references to the JS objects that own the memory being read or written so they can't be
+// collected while the device is still using them.
+//
+// The host function runs on a CUDA driver thread, so it only hands the task back to the JS
+// thread through a ThreadSafeFunction. The ThreadSafeFunction also keeps the event loop alive
+// until the stream reaches the task, so awaiting it is enough to keep the process running.
+class StreamOrderedTask : public Task {
+ public:
+  StreamOrderedTask(Napi::Env env, std::initializer_list<Napi::Value> operands = {}) : Task(env) {
+    for (auto const& operand : operands) {
+      if (operand.IsObject()) { refs_.push_back(Napi::Persistent(operand.As<Napi::Object>())); }
+    }
+  }
+
+  inline Napi::Promise Enqueue(cudaStream_t stream) {
+    auto promise = Promise();
+    // Created on the JS thread so the host function never touches the loop directly
+    tsfn_ = Napi::ThreadSafeFunction::New(Env(), Napi::Function(), "StreamOrderedTask", 0, 1);
+    auto const status = CUDARTAPI::cudaLaunchHostFunc(stream, StreamOrderedTask::Reached, this);
+    if (status != cudaSuccess) {
+      tsfn_.Release();
+      Reject(status);
+    }
+    return promise;
+  }
+
+  using Task::Reject;
+
+  inline StreamOrderedTask& Reject(cudaError_t status) {
+    cudaGetLastError();
+    Task::Reject(nv::cudaError(status, __FILE__, __LINE__, Env()).Value());
+    return *this;
+  }
+
+ private:
+  // Runs on a CUDA driver thread. Copies the ThreadSafeFunction first, because the task may be
+  // settled and deleted on the JS thread as soon as the call is queued.
+  static void Reached(void* data) {
+    auto task = static_cast<StreamOrderedTask*>(data);
+    auto tsfn = task->tsfn_;
+    tsfn.BlockingCall([task](Napi::Env, Napi::Function) { task->Resolve(); });
+    tsfn.Release();
+  }
+
+  Napi::ThreadSafeFunction tsfn_;
+  std::vector<Napi::ObjectReference> refs_;
+};
+
 }  // namespace nv
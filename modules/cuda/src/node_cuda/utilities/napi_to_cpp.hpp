@@ -81,6 +81,11 @@ inline NapiToCPP::operator cudaStream_t() const {
   return reinterpret_cast<cudaStream_t>(this->operator char*());
 }
 
+template <>
+inline NapiToCPP::operator cudaEvent_t() const {
+  return reinterpret_cast<cudaEvent_t>(this->operator char*());
+}
+
 template <>
 inline NapiToCPP::operator cudaUUID_t*() const {
   return reinterpret_cast<cudaUUID_t*>(this->operator char*());
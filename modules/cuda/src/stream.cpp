@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include "node_cuda/task.hpp"
 #include "node_cuda/utilities/cpp_to_napi.hpp"
 #include "node_cuda/utilities/napi_to_cpp.hpp"
 
@@ -29,6 +30,26 @@ Napi::Value cudaStreamCreate(CallbackArgs const& info) {
   return CPPToNapi(info)(stream);
 }
 
+// cudaError_t cudaStreamCreateWithPriority(cudaStream_t *pStream, unsigned int flags, int
+// priority);
+Napi::Value cudaStreamCreateWithPriority(CallbackArgs const& info) {
+  auto env         = info.Env();
+  int32_t priority = info[0];
+  uint32_t flags   = info.Length() > 1 ? info[1] : cudaStreamDefault;
+  cudaStream_t stream;
+  NODE_CUDA_TRY(CUDARTAPI::cudaStreamCreateWithPriority(&stream, flags, priority), env);
+  return CPPToNapi(info)(stream);
+}
+
+// cudaError_t cudaDeviceGetStreamPriorityRange(int *leastPriority, int *greatestPriority);
+Napi::Value cudaDeviceGetStreamPriorityRange(CallbackArgs const& info) {
+  auto env = info.Env();
+  int32_t least, greatest;
+  NODE_CUDA_TRY(CUDARTAPI::cudaDeviceGetStreamPriorityRange(&least, &greatest), env);
+  return CPPToNapi(info)(std::vector<int32_t>{least, greatest},
+                         std::vector<std::string>{"least", "greatest"});
+}
+
 // cudaError_t cudaStreamDestroy(cudaStream_t stream);
 Napi::Value cudaStreamDestroy(CallbackArgs const& info) {
   auto env            = info.Env();
@@ -45,11 +66,41 @@ Napi::Value cudaStreamSynchronize(CallbackArgs const& info) {
   return env.Undefined();
 }
 
+// cudaError_t cudaStreamQuery(cudaStream_t stream);
+Napi::Value cudaStreamQuery(CallbackArgs const& info) {
+  auto env            = info.Env();
+  cudaStream_t stream = info[0];
+  auto const status   = CUDARTAPI::cudaStreamQuery(stream);
+  if (status == cudaErrorNotReady) { return CPPToNapi(info)(false); }
+  NODE_CUDA_TRY(status, env);
+  return CPPToNapi(info)(true);
+}
+
+// cudaError_t cudaStreamWaitEvent(cudaStream_t stream, cudaEvent_t event, unsigned int flags);
+Napi::Value cudaStreamWaitEvent(CallbackArgs const& info) {
+  auto env            = info.Env();
+  cudaStream_t stream = info[0];
+  cudaEvent_t event   = info[1];
+  NODE_CUDA_TRY(CUDARTAPI::cudaStreamWaitEvent(stream, event, 0), env);
+  return env.Undefined();
+}
+
+// Resolves when the work enqueued on the stream so far has completed, without blocking.
+Napi::Value cudaStreamSynchronizeAsync(CallbackArgs const& info) {
+  cudaStream_t stream = info[0];
+  return (new StreamOrderedTask(info.Env()))->Enqueue(stream);
+}
+
 namespace stream {
 Napi::Object initModule(Napi::Env env, Napi::Object exports) {
   EXPORT_FUNC(env, exports, "create", nv::cudaStreamCreate);
+  EXPORT_FUNC(env, exports, "createWithPriority", nv::cudaStreamCreateWithPriority);
+  EXPORT_FUNC(env, exports, "getPriorityRange", nv::cudaDeviceGetStreamPriorityRange);
   EXPORT_FUNC(env, exports, "destroy", nv::cudaStreamDestroy);
+  EXPORT_FUNC(env, exports, "query", nv::cudaStreamQuery);
+  EXPORT_FUNC(env, exports, "waitEvent", nv::cudaStreamWaitEvent);
   EXPORT_FUNC(env, exports, "synchronize", nv::cudaStreamSynchronize);
+  EXPORT_FUNC(env, exports, "synchronizeAsync", nv::cudaStreamSynchronizeAsync);
 
   return exports;
 }
@@ -0,0 +1,127 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import CUDA, {CUevent, CUstream} from './addon';
+
+/**
+ * @summary A CUDA event that can be recorded on a stream and awaited or timed from JS.
+ */
+export class CUDAEvent {
+  /**
+   * @param flags Event creation flags, e.g. `CUDA.event.flags.disableTiming`. Events created
+   * without timing are cheaper to record and are sufficient for cross-stream dependencies.
+   */
+  constructor(flags = CUDA.event.flags.default) { this._event = CUDA.event.create(flags); }
+
+  private _event: CUevent;
+
+  /** The native `cudaEvent_t` handle. */
+  public get handle(): CUevent { return this._event; }
+
+  /**
+   * @summary Capture the work enqueued on `stream` so far.
+   * @param stream The stream to record on. Defaults to the legacy default stream.
+   */
+  public record(stream: CUstream = 0) {
+    CUDA.event.record(this._event, stream);
+    return this;
+  }
+
+  /** @summary Returns whether the captured work has completed, without blocking. */
+  public query() { return CUDA.event.query(this._event); }
+
+  /** @summary Block the calling thread until the captured work has completed. */
+  public synchronize() { CUDA.event.synchronize(this._event); }
+
+  /**
+   * @summary Returns a Promise that resolves once the captured work has completed. Unlike
+   * `synchronize()`, this does not block the JS thread.
+   */
+  public completed() { return CUDA.event.completed(this._event); }
+
+  /**
+   * @summary Make all future work enqueued on `stream` wait for the captured work.
+   */
+  public waitOn(stream: CUstream) {
+    CUDA.stream.waitEvent(stream, this._event);
+    return this;
+  }
+
+  /**
+   * @summary Returns the elapsed time in milliseconds between `start` and this event. Both
+   * events must have been recorded with timing enabled and have completed.
+   */
+  public elapsedTime(start: CUDAEvent) { return CUDA.event.elapsedTime(start._event, this._event); }
+
+  public destroy() {
+    if (this._event) {
+      CUDA.event.destroy(this._event);
+      this._event = 0;
+    }
+  }
+}
+
+export interface StreamPoolOptions {
+  /**
+   * Priority of the streams in the pool. Lower numbers are higher priority. Values are clamped
+   * by the driver to the range returned by `StreamPool.priorityRange()`.
+   */
+  priority?: number;
+}
+
+/**
+ * @summary A fixed-size set of non-default streams that are handed out round-robin, so
+ * independent work can overlap without paying for stream creation on every call.
+ */
+export class StreamPool {
+  /**
+   * @summary Returns the range of stream priorities supported by the current device.
+   * `greatest` is the numerically lowest (highest priority) value.
+   */
+  static priorityRange() { return CUDA.stream.getPriorityRange(); }
+
+  constructor(size = 16, {priority}: StreamPoolOptions = {}) {
+    this._streams = Array.from({length: Math.max(1, size)},
+                               () => priority === undefined
+                                       ? CUDA.stream.create()
+                                       : CUDA.stream.createWithPriority(priority));
+  }
+
+  private _next = 0;
+  private _streams: CUstream[];
+
+  /** The number of streams in the pool. */
+  public get size() { return this._streams.length; }
+
+  /** @summary Returns the next stream in the pool. */
+  public next() {
+    const stream = this._streams[this._next];
+    this._next   = (this._next + 1) % this._streams.length;
+    return stream;
+  }
+
+  /** @summary Block until all the streams in the pool are idle. */
+  public synchronize() { this._streams.forEach((s) => CUDA.stream.synchronize(s)); }
+
+  /** @summary Returns a Promise that resolves once all the streams in the pool are idle. */
+  public async synchronizeAsync() {
+    await Promise.all(this._streams.map((s) => CUDA.stream.synchronizeAsync(s)));
+  }
+
+  public destroy() {
+    this._streams.forEach((s) => CUDA.stream.destroy(s));
+    this._streams = [];
+    this._next    = 0;
+  }
+}
@@ -19,11 +19,14 @@ import {
   Int32Buffer,
   Int64Buffer,
   Int8Buffer,
+  memcpyBatch,
+  memcpyBatchAsync,
   Uint16Buffer,
   Uint32Buffer,
   Uint64Buffer,
   Uint8Buffer,
 } from '@nvidia/cuda';
+import {spawnSync} from 'child_process';
 
 describe.each([
   Int8Buffer,
@@ -117,3 +120,60 @@ describe.each([
     expect(hbuf).toEqual(testBuffer);
   });
 });
+
+test(`memcpyBatch copies and coalesces many ranges`, async () => {
+  const src = new Uint8Buffer(Array.from({length: 256}, (_, i) => i));
+  const dst = new Uint8Buffer(256).fill(0);
+  // Two contiguous ranges (coalesced into one copy) and one disjoint range
+  memcpyBatch([
+    {dst, dstOffset: 0, src, srcOffset: 0, length: 16},
+    {dst, dstOffset: 16, src, srcOffset: 16, length: 16},
+    {dst, dstOffset: 128, src, srcOffset: 64, length: 8},
+  ]);
+  const result = dst.toArray();
+  expect([...result.subarray(0, 32)]).toEqual([...src.toArray().subarray(0, 32)]);
+  expect([...result.subarray(128, 136)]).toEqual([64, 65, 66, 67, 68, 69, 70, 71]);
+  expect(result[32]).toBe(0);
+
+  const host = new Uint8Array(8);
+  await memcpyBatchAsync([{dst: host, src, srcOffset: 8, length: 8}]);
+  expect([...host]).toEqual([8, 9, 10, 11, 12, 13, 14, 15]);
+});
+
+test(`memcpyBatch validates every range before copying`, () => {
+  const src = new Uint8Buffer(Array.from({length: 16}, (_, i) => i + 1));
+  const dst = new Uint8Buffer(16).fill(0);
+  // Zero-length arrays still have a known size, so offsets into them are bounds checked
+  expect(() => memcpyBatch([{dst: new Uint8Array(0), src, srcOffset: 0, dstOffset: 4, length: 1}]))
+    .toThrow();
+  expect(() => memcpyBatch([{dst, src, dstOffset: -1, length: 1}])).toThrow();
+  expect(() => memcpyBatch([{dst, src, srcOffset: NaN, length: 1}])).toThrow();
+  expect(() => memcpyBatch([{dst, src, length: 1.5}])).toThrow();
+  // A bad range anywhere in the batch prevents the earlier ranges from being copied
+  expect(() => memcpyBatch([
+           {dst, src, length: 8},
+           {dst, src, dstOffset: 8, srcOffset: 12, length: 8},
+         ]))
+    .toThrow();
+  expect([...dst.toArray()]).toEqual(new Array(16).fill(0));
+});
+
+test(`memcpyBatchAsync keeps a process with no other loop handles alive`, () => {
+  // Run outside of jest, which keeps the event loop alive on its own
+  const script = `
+const { memcpyBatchAsync, StreamPool, Uint8Buffer } = require(".");
+(async () => {
+  const pool = new StreamPool(1);
+  const src = new Uint8Buffer(1 << 20).fill(3);
+  const host = new Uint8Array(1 << 20);
+  await memcpyBatchAsync([{dst: host, src, length: host.byteLength}], pool.next());
+  process.stdout.write(JSON.stringify(host.every((x) => x === 3)));
+})();
+`;
+  const {stdout} = spawnSync('node', ['-e', script], {
+    encoding: 'utf8',
+    stdio: ['ignore', 'pipe', 'inherit'],
+    timeout: 60000,
+  });
+  expect(stdout).toStrictEqual('true');
+});
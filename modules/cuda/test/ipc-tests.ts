@@ -51,6 +51,25 @@ async function readChildProcessOutput(proc: ChildProcessByStdio<Writable, Readab
   })();
 }
 
+test(`ipc handles opened twice share a mapping, and views don't copy`, async () => {
+  let src: ChildProcessByStdio<Writable, Readable, null>|undefined;
+  let dst: ChildProcessByStdio<Writable, Readable, null>|undefined;
+  try {
+    src        = spawnIPCSourceSubprocess(3, 4);
+    const hndl = await readChildProcessOutput(src);
+    if (hndl) {
+      dst        = spawnIPCViewSubprocess(JSON.parse(hndl));
+      const data = await readChildProcessOutput(dst);
+      expect(data).toStrictEqual('[true,6,[3,4]]');
+    } else {
+      throw new Error(`Invalid IPC handle from source child process: ${JSON.stringify(hndl)}`);
+    }
+  } finally {
+    dst && !dst.killed && dst.kill();
+    src && !src.killed && src.kill();
+  }
+});
+
 function spawnIPCSourceSubprocess(first: number, second: number) {
   return spawn('node',
                [
@@ -82,3 +101,21 @@ process.stdout.write(JSON.stringify([...hmem]));
                ],
                {stdio: ['pipe', 'pipe', 'inherit']});
 }
+
+function spawnIPCViewSubprocess({handle}: {handle: Array<number>}) {
+  return spawn('node',
+               [
+                 '-e',
+                 `
+const { Uint8Buffer, IpcMemory } = require(".");
+const hmem = new Uint8Array(2);
+const a = new IpcMemory([${handle.toString()}]);
+const b = new IpcMemory([${handle.toString()}]);
+const view = a.view(2, 8);
+a.close();
+new Uint8Buffer(view.view(1, 3)).copyInto(hmem);
+process.stdout.write(JSON.stringify([a.ptr === 0 && b.ptr !== 0, view.byteLength, [...hmem]]));
+`
+               ],
+               {stdio: ['pipe', 'pipe', 'inherit']});
+}
@@ -0,0 +1,34 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import {PinnedMemory} from '@nvidia/cuda';
+
+test(`PinnedMemory allocates from the pinned memory pool`, () => {
+  const before = PinnedMemory.poolStatistics();
+  const mem    = new PinnedMemory(5000);
+  const after  = PinnedMemory.poolStatistics();
+  expect(mem.byteLength).toBe(5000);
+  // Rounded up to the 8KiB size class
+  expect(after.usedBytes - before.usedBytes).toBe(8192);
+  expect(after.hits + after.misses).toBe(before.hits + before.misses + 1);
+});
+
+test(`PinnedMemory pool limit and trim`, () => {
+  const {maxPinnedBytes} = PinnedMemory.poolStatistics();
+  PinnedMemory.setMaxPinnedBytes(1 << 20);
+  expect(PinnedMemory.poolStatistics().maxPinnedBytes).toBe(1 << 20);
+  expect(PinnedMemory.trimPool()).toBeGreaterThanOrEqual(0);
+  expect(PinnedMemory.poolStatistics().cachedBytes).toBe(0);
+  PinnedMemory.setMaxPinnedBytes(maxPinnedBytes);
+});
@@ -0,0 +1,82 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import {CUDA, CUDAEvent, DeviceMemory, StreamPool, Uint8Buffer} from '@nvidia/cuda';
+import {spawnSync} from 'child_process';
+
+test(`StreamPool hands out streams round-robin`, () => {
+  const pool    = new StreamPool(2);
+  const [a, b] = [pool.next(), pool.next()];
+  expect(a).not.toBe(b);
+  expect(pool.next()).toBe(a);
+  pool.synchronize();
+  pool.destroy();
+});
+
+test(`StreamPool creates priority streams`, () => {
+  const {greatest} = StreamPool.priorityRange();
+  const pool       = new StreamPool(1, {priority: greatest});
+  expect(pool.size).toBe(1);
+  pool.destroy();
+});
+
+test(`CUDAEvent completion can be awaited and timed`, async () => {
+  const pool  = new StreamPool(1);
+  const start = new CUDAEvent().record(pool.next());
+  const mem   = new DeviceMemory(1 << 20);
+  CUDA.runtime.cudaMemset(mem, 0, mem.byteLength, pool.next());
+  const end = new CUDAEvent().record(pool.next());
+  await end.completed();
+  expect(end.query()).toBe(true);
+  expect(end.elapsedTime(start)).toBeGreaterThanOrEqual(0);
+  await pool.synchronizeAsync();
+  [start, end].forEach((e) => e.destroy());
+  pool.destroy();
+});
+
+test(`cudaMemsetAsync and cudaMemcpyAsync resolve when the stream reaches them`, async () => {
+  const pool   = new StreamPool(1);
+  const stream = pool.next();
+  const device = new Uint8Buffer(new DeviceMemory(1024));
+  const host   = new Uint8Array(1024);
+  await CUDA.runtime.cudaMemsetAsync(device, 7, device.byteLength, stream);
+  await CUDA.runtime.cudaMemcpyAsync(host, device, device.byteLength, stream);
+  expect(host.every((x) => x === 7)).toBe(true);
+  pool.destroy();
+});
+
+test(`stream-ordered promises keep a process with no other loop handles alive`, () => {
+  // Jest keeps its own event loop alive, so run the awaits in a bare node process. If nothing
+  // holds the loop open until the stream reaches each task, the child exits without output.
+  const script = `
+const { CUDA, CUDAEvent, DeviceMemory, StreamPool, Uint8Buffer } = require(".");
+(async () => {
+  const pool = new StreamPool(1);
+  const stream = pool.next();
+  const device = new Uint8Buffer(new DeviceMemory(1 << 20));
+  const host = new Uint8Array(1 << 20);
+  await CUDA.runtime.cudaMemsetAsync(device, 7, device.byteLength, stream);
+  await CUDA.runtime.cudaMemcpyAsync(host, device, device.byteLength, stream);
+  await new CUDAEvent().record(stream).completed();
+  await pool.synchronizeAsync();
+  process.stdout.write(JSON.stringify(host.every((x) => x === 7)));
+})();
+`;
+  const {stdout} = spawnSync('node', ['-e', script], {
+    encoding: 'utf8',
+    stdio: ['ignore', 'pipe', 'inherit'],
+    timeout: 60000,
+  });
+  expect(stdout).toStrictEqual('true');
+});
@@ -15,9 +15,13 @@
 #include <node_cudf/addon.hpp>
 #include <node_cudf/column.hpp>
 #include <node_cudf/groupby.hpp>
+#include <node_cudf/hash_join.hpp>
 #include <node_cudf/scalar.hpp>
+#include <node_cudf/spill_manager.hpp>
 #include <node_cudf/table.hpp>
+#include <node_cudf/table_builder.hpp>
 #include <node_cudf/utilities/dtypes.hpp>
+#include <node_cudf/utilities/stream.hpp>
 
 #include <nv_node/macros.hpp>
 
@@ -35,11 +39,16 @@ Napi::Value cudfInit(Napi::CallbackInfo const& info) {
 Napi::Object initModule(Napi::Env env, Napi::Object exports) {
   EXPORT_FUNC(env, exports, "init", nv::cudfInit);
   EXPORT_FUNC(env, exports, "findCommonType", nv::find_common_type);
+  EXPORT_FUNC(env, exports, "getCurrentStream", nv::current_stream);
+  EXPORT_FUNC(env, exports, "setCurrentStream", nv::exchange_current_stream);
 
   nv::Column::Init(env, exports);
   nv::Table::Init(env, exports);
   nv::Scalar::Init(env, exports);
   nv::GroupBy::Init(env, exports);
+  nv::HashJoinIndex::Init(env, exports);
+  nv::TableBuilder::Init(env, exports);
+  nv::SpillManager::Init(env, exports);
 
   return exports;
 }
@@ -132,6 +132,8 @@ Napi::Object Column::Init(Napi::Env env, Napi::Object exports) {
                   InstanceAccessor<&Column::null_count>("nullCount"),
                   InstanceAccessor<&Column::is_nullable>("nullable"),
                   InstanceAccessor<&Column::num_children>("numChildren"),
+                  InstanceAccessor<&Column::spillable, &Column::spillable>("spillable"),
+                  InstanceAccessor<&Column::spilled>("spilled"),
 
                   InstanceMethod<&Column::get_child>("getChild"),
                   InstanceMethod<&Column::get_value>("getValue"),
@@ -139,6 +141,10 @@ Napi::Object Column::Init(Napi::Env env, Napi::Object exports) {
                   InstanceMethod<&Column::set_null_count>("setNullCount"),
                   // column/copying.cpp
                   InstanceMethod<&Column::gather>("gather"),
+                  // column/dictionary.cpp
+                  InstanceMethod<&Column::encode_dictionary>("encodeDictionary"),
+                  InstanceMethod<&Column::decode_dictionary>("decodeDictionary"),
+                  StaticMethod<&Column::make_dictionary>("makeDictionary"),
                   // column/binaryop.cpp
                   InstanceMethod<&Column::add>("add"),
                   InstanceMethod<&Column::sub>("sub"),
@@ -171,9 +177,15 @@ Napi::Object Column::Init(Napi::Env env, Napi::Object exports) {
                   // column/stream_compaction.cpp
                   InstanceMethod<&Column::drop_nulls>("drop_nulls"),
                   InstanceMethod<&Column::drop_nans>("drop_nans"),
+                  // column/rolling.cpp
+                  InstanceMethod<&Column::rolling_window>("rolling"),
+                  InstanceMethod<&Column::range_rolling_window>("rollingRange"),
                   // column/transform.cpp
                   InstanceMethod<&Column::nans_to_nulls>("nans_to_nulls"),
+                  InstanceMethod<&Column::spill>("spill"),
                   // column/reduction.cpp
+                  InstanceMethod<&Column::stats>("stats"),
+                  InstanceMethod<&Column::describe>("describe"),
                   InstanceMethod<&Column::min>("min"),
                   InstanceMethod<&Column::max>("max"),
                   InstanceMethod<&Column::minmax>("minmax"),
@@ -188,6 +200,7 @@ Napi::Object Column::Init(Napi::Env env, Napi::Object exports) {
                   InstanceMethod<&Column::variance>("var"),
                   InstanceMethod<&Column::std>("std"),
                   InstanceMethod<&Column::quantile>("quantile"),
+                  InstanceMethod<&Column::quantiles>("quantiles"),
                   // column/unaryop.cpp
                   InstanceMethod<&Column::cast>("cast"),
                   InstanceMethod<&Column::is_null>("isNull"),
@@ -239,6 +252,9 @@ ObjectUnwrap<Column> Column::New(std::unique_ptr<cudf::column> column) {
   auto mask     = std::move(contents.null_mask);
   auto children = std::move(contents.children);
 
+  // The buffers already carry the stream libcudf allocated them on, which is the current stream
+  // only for the operations that take one, so leave them as they are.
+
   props.Set("children", [&]() {
     auto ary = Napi::Array::New(env, children.size());
     for (size_t i = 0; i < children.size(); ++i) {  //
@@ -250,9 +266,11 @@ ObjectUnwrap<Column> Column::New(std::unique_ptr<cudf::column> column) {
   props.Set("data", DeviceBuffer::New(std::move(data))->Value());
   props.Set("nullMask", DeviceBuffer::New(std::move(mask))->Value());
 
-  return constructor.New({props});
+  return New(props);
 }
 
+ObjectUnwrap<Column> Column::New(Napi::Object const& props) { return constructor.New({props}); }
+
 Column::Column(CallbackArgs const& args) : Napi::ObjectWrap<Column>(args) {
   auto env = args.Env();
 
@@ -271,8 +289,9 @@ Column::Column(CallbackArgs const& args) : Napi::ObjectWrap<Column>(args) {
   this->children_ = Napi::Persistent(props.Has("children") ? props.Get("children").As<Napi::Array>()
                                                            : Napi::Array::New(Env(), 0));
 
-  auto const data = get_or_create_data(props.Get("data"), type());
-  this->data_     = data.reference();
+  auto const data   = get_or_create_data(props.Get("data"), type());
+  this->data_       = data.reference();
+  this->data_share_ = data->share();
 
   this->size_ = props.Get("length");
 
@@ -284,6 +303,8 @@ Column::Column(CallbackArgs const& args) : Napi::ObjectWrap<Column>(args) {
       if (num_children() > 0) { this->size_ = child(0).size() - 1; }
     } else if (type.id() == cudf::type_id::STRING) {
       if (num_children() > 0) { this->size_ = child(0).size() - 1; }
+    } else if (type.id() == cudf::type_id::DICTIONARY32) {
+      if (num_children() > 0) { this->size_ = child(0).size(); }
     } else if (type.id() == cudf::type_id::STRUCT) {
       if (num_children() > 0) {
         this->size_ = child(0).size();
@@ -312,7 +333,8 @@ Column::Column(CallbackArgs const& args) : Napi::ObjectWrap<Column>(args) {
     return DeviceBuffer::New();
   }();
 
-  this->null_mask_ = mask.reference();
+  this->null_mask_  = mask.reference();
+  this->mask_share_ = mask->share();
   if (!nullable()) {
     this->null_count_ = 0;
   } else if (!(props.Has("nullCount") && props.Get("nullCount").IsNumber())) {
@@ -324,10 +346,16 @@ Column::Column(CallbackArgs const& args) : Napi::ObjectWrap<Column>(args) {
 }
 
 void Column::Finalize(Napi::Env env) {
+  if (spillable_) { SpillManager::get().untrack(*this); }
+  spilled_data_.reset();
+  spilled_mask_.reset();
+  data_share_.reset();
+  mask_share_.reset();
   data_.Reset();
   type_.Reset();
   null_mask_.Reset();
   children_.Reset();
+  invalidate_stats();
 }
 
 // If the null count is known, return it. Else, compute and return it
@@ -342,9 +370,13 @@ cudf::size_type Column::null_count() const {
 }
 
 void Column::set_null_mask(Napi::Value const& new_null_mask, cudf::size_type new_null_count) {
+  invalidate_stats();
+  spilled_mask_.reset();
   null_count_ = new_null_count;
   if (new_null_mask.IsNull() || new_null_mask.IsUndefined()) {
-    null_mask_ = DeviceBuffer::New().reference();
+    auto const mask = DeviceBuffer::New();
+    null_mask_      = mask.reference();
+    mask_share_     = mask->share();
   } else {
     ObjectUnwrap<DeviceBuffer> new_mask = new_null_mask;
     if (new_null_count > 0) {
@@ -352,7 +384,8 @@ void Column::set_null_mask(Napi::Value const& new_null_mask, cudf::size_type new
                        "Column with null values must be nullable, and the null mask "
                        "buffer size should match the size of the column.");
     }
-    null_mask_ = new_mask.reference();
+    null_mask_  = new_mask.reference();
+    mask_share_ = new_mask->share();
   }
 }
 
@@ -361,7 +394,15 @@ void Column::set_null_count(cudf::size_type new_null_count) {
   null_count_ = new_null_count;
 }
 
+void Column::invalidate_stats() const {
+  min_.Reset();
+  max_.Reset();
+  is_sorted_      = -1;
+  distinct_count_ = {-1, -1};
+}
+
 cudf::column_view Column::view() const {
+  if (spillable_) { SpillManager::get().touch(*this); }
   auto type     = this->type();
   auto& data    = this->data();
   auto& mask    = this->null_mask();
@@ -385,6 +426,7 @@ cudf::column_view Column::view() const {
 }
 
 cudf::mutable_column_view Column::mutable_view() {
+  if (spillable_) { SpillManager::get().touch(*this); }
   auto type     = this->type();
   auto& data    = this->data();
   auto& mask    = this->null_mask();
@@ -408,6 +450,8 @@ cudf::mutable_column_view Column::mutable_view() {
   // existing `null_count` is no longer valid. Reset it to `UNKNOWN_NULL_COUNT` forcing it to be
   // recomputed on the next invocation of `null_count()`.
   set_null_count(cudf::UNKNOWN_NULL_COUNT);
+  // Likewise the cached min, max, etc. may no longer describe the elements.
+  invalidate_stats();
 
   return cudf::mutable_column_view{type,
                                    size(),
@@ -433,6 +477,7 @@ ObjectUnwrap<Column> Column::operator[](Column const& selection) const {
 
 Napi::Value Column::type(Napi::CallbackInfo const& info) { return type_.Value(); }
 void Column::type(Napi::CallbackInfo const& info, Napi::Value const& value) {
+  invalidate_stats();
   type_ = Napi::Persistent(value.As<Napi::Object>());
 }
 
@@ -440,7 +485,10 @@ Napi::Value Column::size(Napi::CallbackInfo const& info) { return CPPToNapi(info
 
 Napi::Value Column::offset(Napi::CallbackInfo const& info) { return CPPToNapi(info)(offset()); }
 
-Napi::Value Column::data(Napi::CallbackInfo const& info) { return data_.Value(); }
+Napi::Value Column::data(Napi::CallbackInfo const& info) {
+  unspill();
+  return data_.Value();
+}
 
 Napi::Value Column::has_nulls(Napi::CallbackInfo const& info) {
   return CPPToNapi(info)(null_count() > 0);
@@ -454,7 +502,10 @@ Napi::Value Column::num_children(Napi::CallbackInfo const& info) {
   return CPPToNapi(info)(num_children());
 }
 
-Napi::Value Column::null_mask(Napi::CallbackInfo const& info) { return null_mask_.Value(); }
+Napi::Value Column::null_mask(Napi::CallbackInfo const& info) {
+  unspill();
+  return null_mask_.Value();
+}
 
 Napi::Value Column::set_null_mask(Napi::CallbackInfo const& info) {
   CallbackArgs args{info};
@@ -494,8 +545,14 @@ Napi::Value Column::gather(Napi::CallbackInfo const& info) {
     throw Napi::Error::New(info.Env(), "gather selection argument expects a Column");
   }
   auto& selection = *Column::Unwrap(args[0]);
-  auto result     = (*this)[selection];
-  return result->Value();
+  if (selection.type().id() == cudf::type_id::BOOL8) {
+    return this->apply_boolean_mask(selection)->Value();
+  }
+  bool const nullify = args.Length() > 1 && args[1].IsBoolean() && args[1].ToBoolean();
+  return this
+    ->gather(selection,
+             nullify ? cudf::out_of_bounds_policy::NULLIFY : cudf::out_of_bounds_policy::DONT_CHECK)
+    ->Value();
 }
 
 Napi::Value Column::get_child(Napi::CallbackInfo const& info) {
@@ -20,13 +20,18 @@ import {Scalar} from './scalar';
 import {
   Bool8,
   DataType,
+  Dictionary,
   Float64,
   IndexType,
+  Int32,
   Int64,
   Integral,
   Numeric,
+  Uint16,
+  Uint32,
+  Uint8,
 } from './types/dtypes';
-import {CommonType, Interpolation} from './types/mappings';
+import {CommonType, Interpolation, RollingAggregation} from './types/mappings';
 
 export type ColumnProps<T extends DataType = any> = {
   /*
@@ -65,9 +70,34 @@ export type ColumnProps<T extends DataType = any> = {
   children?: ReadonlyArray<Column>|null;
 };
 
+/**
+ * Statistics about a Column's elements. Fields are only present once they've been computed.
+ */
+export type ColumnStats<T extends DataType = any> = {
+  nullCount?: number;
+  min?: T['scalarType'];
+  max?: T['scalarType'];
+  isSorted?: boolean;
+  distinctCount?: number;
+};
+
 interface ColumnConstructor {
   readonly prototype: Column;
   new<T extends DataType = any>(props: ColumnProps<T>): Column<T>;
+
+  /**
+   * Construct a dictionary Column from unique keys and the integer index of each row's key, such
+   * as the dictionary and indices of an Arrow DictionaryVector. Unsorted keys are sorted and the
+   * indices remapped.
+   *
+   * @param keys The unique, non-null dictionary keys.
+   * @param indices The index of each row's key. Null indices become null rows.
+   * @param memoryResource The optional MemoryResource used to allocate the result Column's device
+   *   memory.
+   */
+  makeDictionary<T extends DataType>(keys: Column<T>,
+                                     indices: Column<IndexType>,
+                                     memoryResource?: MemoryResource): Column<Dictionary<T>>;
 }
 
 /**
@@ -85,12 +115,57 @@ export interface Column<T extends DataType = any> {
   readonly nullCount: number;
   readonly numChildren: number;
 
+  /**
+   * Whether the spill manager may move this Column's device memory to host memory or disk when
+   * the device memory held by spillable Columns exceeds the limit set by `setSpillOptions()`.
+   * Setting this also applies to the Column's children.
+   *
+   * Columns that share device memory with another Column (e.g. a zero-copy slice), a DeviceBuffer
+   * view, a GroupBy, a HashJoinIndex or a TableBuilder are never spilled while it's shared. Don't
+   * mark Columns spillable if their `data` or `nullMask` DeviceBuffers are used directly.
+   */
+  spillable: boolean;
+
+  /**
+   * Whether this Column's device memory is currently spilled. Spilled Columns are copied back into
+   * device memory the next time they are used.
+   */
+  readonly spilled: boolean;
+
+  /**
+   * Move this Column's data and null mask out of device memory.
+   *
+   * @returns The number of bytes of device memory freed, or 0 if its device memory is shared.
+   */
+  spill(): number;
+
   /**
    * Return sub-selection from a Column
    *
    * @param selection
+   * @param nullifyOutOfBounds If true, rows for out-of-bounds indices in `selection` are null.
+   *   Otherwise out-of-bounds indices are undefined behavior.
+   */
+  gather(selection: Column<IndexType|Bool8>, nullifyOutOfBounds?: boolean): Column<T>;
+
+  /**
+   * Dictionary-encode this Column into sorted unique keys and the index of each row's key.
+   *
+   * @param indicesType The unsigned integer type of the indices. Default: Uint32
+   * @param memoryResource The optional MemoryResource used to allocate the result Column's device
+   *   memory.
+   */
+  encodeDictionary(indicesType?: Uint8|Uint16|Uint32,
+                   memoryResource?: MemoryResource): Column<Dictionary<T>>;
+
+  /**
+   * Decode a dictionary Column into a Column of its keys' type.
+   *
+   * @param memoryResource The optional MemoryResource used to allocate the result Column's device
+   *   memory.
    */
-  gather(selection: Column<IndexType|Bool8>): Column<T>;
+  decodeDictionary(memoryResource?: MemoryResource):
+    Column<T extends Dictionary ? T['dictionary'] : never>;
 
   /**
    * Return a child at the specified index to host memory
@@ -780,6 +855,24 @@ export interface Column<T extends DataType = any> {
    */
   not(memoryResource?: MemoryResource): Column<Bool8>;
 
+  /**
+   * Return the statistics about this Column's elements that have already been computed by earlier
+   * reductions (`minmax`, `nunique`, etc.). Cached statistics are discarded when the Column is
+   * mutated through its own methods. Writes made through `data` or `mask`, or through a slice or
+   * view that shares this Column's memory, aren't tracked and leave the cached statistics stale.
+   *
+   * @returns The cached statistics for this Column.
+   */
+  stats(): ColumnStats<T>;
+
+  /**
+   * Compute and cache the null count, min, max, sortedness, and distinct count of this Column.
+   *
+   * @param memoryResource The optional MemoryResource used to allocate temporary device memory.
+   * @returns The statistics for this Column.
+   */
+  describe(memoryResource?: MemoryResource): ColumnStats<T>;
+
   /**
    * Compute the min of all values in this Column.
    *
@@ -917,6 +1010,20 @@ export interface Column<T extends DataType = any> {
    */
   quantile(q?: number, interpolation?: Interpolation, memoryResource?: MemoryResource): number;
 
+  /**
+   * Return values at each of the given quantiles, sorting the column only once. Null values are
+   * ignored.
+   *
+   * @param q the quantiles to compute, 0 <= q <= 1
+   * @param interpolation This optional parameter specifies the interpolation method to use,
+   *  when the desired quantile lies between two data points i and j.
+   * @param memoryResource The optional MemoryResource used to allocate the result column's device
+   *   memory.
+   * @returns A Column of the values at each quantile.
+   */
+  quantiles(q: number[], interpolation?: Interpolation, memoryResource?: MemoryResource):
+    Column<Float64>;
+
   /**
    * drop NA values from the column if column is of floating-type
    * values and contains NA values
@@ -944,6 +1051,55 @@ export interface Column<T extends DataType = any> {
    * @returns undefined if inplace=True, else updated column with Null values
    */
   nans_to_nulls(memoryResource?: MemoryResource): Column<T>;
+
+  /**
+   * Compute an aggregation over a fixed-size rolling window of rows.
+   *
+   * @param agg The aggregation to compute over each window.
+   * @param preceding The number of rows in the window before and including each row, or a Column
+   *   of per-row window sizes.
+   * @param following The number of rows in the window after each row, or a Column of per-row
+   *   window sizes.
+   * @param minPeriods The minimum number of non-null values in a window required to produce a
+   *   non-null result.
+   * @param memoryResource The optional MemoryResource used to allocate the result column's device
+   *   memory.
+   * @returns A Column of the aggregation results of each window.
+   */
+  rolling(agg: RollingAggregation,
+          preceding: number,
+          following: number,
+          minPeriods: number,
+          memoryResource?: MemoryResource): Column;
+  rolling(agg: RollingAggregation,
+          preceding: Column<Int32>,
+          following: Column<Int32>,
+          minPeriods: number,
+          memoryResource?: MemoryResource): Column;
+
+  /**
+   * Compute an aggregation over windows defined by a range of values in `orderBy`. The window of
+   * row `i` includes each row `j` where
+   * `orderBy[i] - preceding <= orderBy[j] <= orderBy[i] + following`.
+   *
+   * @param agg The aggregation to compute over each window.
+   * @param orderBy A Column sorted in ascending order without nulls, the same length as this
+   *   Column.
+   * @param preceding The range of values before each row. Durations for timestamp columns are in
+   *   the units of the timestamp.
+   * @param following The range of values after each row.
+   * @param minPeriods The minimum number of non-null values in a window required to produce a
+   *   non-null result.
+   * @param memoryResource The optional MemoryResource used to allocate the result column's device
+   *   memory.
+   * @returns A Column of the aggregation results of each window.
+   */
+  rollingRange(agg: RollingAggregation,
+               orderBy: Column,
+               preceding: number|bigint,
+               following: number|bigint,
+               minPeriods: number,
+               memoryResource?: MemoryResource): Column;
 }
 
 // eslint-disable-next-line @typescript-eslint/no-redeclare
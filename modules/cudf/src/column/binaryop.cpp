@@ -14,10 +14,12 @@
 
 #include <node_cudf/column.hpp>
 #include <node_cudf/utilities/dtypes.hpp>
+#include <node_cudf/utilities/stream.hpp>
 
 #include <node_rmm/memory_resource.hpp>
 
 #include <cudf/binaryop.hpp>
+#include <cudf/detail/binaryop.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
@@ -52,14 +54,16 @@ ObjectUnwrap<Column> Column::binary_operation(Column const& rhs,
                                               cudf::binary_operator op,
                                               cudf::type_id output_type,
                                               rmm::mr::device_memory_resource* mr) const {
-  return Column::New(cudf::binary_operation(*this, rhs, op, cudf::data_type{output_type}, mr));
+  return Column::New(cudf::detail::binary_operation(
+    *this, rhs, op, cudf::data_type{output_type}, get_current_stream(), mr));
 }
 
 ObjectUnwrap<Column> Column::binary_operation(Scalar const& rhs,
                                               cudf::binary_operator op,
                                               cudf::type_id output_type,
                                               rmm::mr::device_memory_resource* mr) const {
-  return Column::New(cudf::binary_operation(*this, rhs, op, cudf::data_type{output_type}, mr));
+  return Column::New(cudf::detail::binary_operation(
+    *this, rhs, op, cudf::data_type{output_type}, get_current_stream(), mr));
 }
 
 ObjectUnwrap<Column> Column::operator+(Column const& other) const { return add(other); }
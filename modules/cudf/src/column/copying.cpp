@@ -13,8 +13,11 @@
 // limitations under the License.
 
 #include <node_cudf/column.hpp>
+#include <node_cudf/utilities/error.hpp>
+#include <node_cudf/utilities/stream.hpp>
 
 #include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/table/table_view.hpp>
 
 #include <memory>
@@ -24,9 +27,32 @@ namespace nv {
 ObjectUnwrap<Column> Column::gather(Column const& gather_map,
                                     cudf::out_of_bounds_policy bounds_policy,
                                     rmm::mr::device_memory_resource* mr) const {
-  auto result = cudf::gather(cudf::table_view{{*this}}, gather_map, bounds_policy, mr);
+  auto result = cudf::detail::gather(cudf::table_view{{*this}},
+                                     gather_map,
+                                     bounds_policy,
+                                     cudf::detail::negative_index_policy::ALLOWED,
+                                     get_current_stream(),
+                                     mr);
   std::vector<std::unique_ptr<cudf::column>> contents = result->release();
   return Column::New(std::move(contents[0]));
 }
 
+ObjectUnwrap<Column> Column::slice(cudf::size_type begin, cudf::size_type end) const {
+  auto env = Env();
+  NODE_CUDF_EXPECT(0 <= begin && begin <= end && end <= size(), "Slice bounds out of range", env);
+
+  // The Column constructor infers the size of zero-length Columns from their data
+  if (begin == end) { return Column::New(cudf::empty_like(view())); }
+
+  auto props = Napi::Object::New(env);
+  props.Set("type", type_.Value());
+  props.Set("offset", offset() + begin);
+  props.Set("length", end - begin);
+  props.Set("data", data().Value());
+  props.Set("nullMask", null_mask().Value());
+  props.Set("children", children_.Value());
+  if (null_count_ == 0 || (begin == 0 && end == size())) { props.Set("nullCount", null_count_); }
+  return Column::New(props);
+}
+
 }  // namespace nv
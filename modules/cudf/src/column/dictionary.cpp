@@ -0,0 +1,135 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <node_cudf/column.hpp>
+#include <node_cudf/utilities/error.hpp>
+#include <node_cudf/utilities/napi_to_cpp.hpp>
+#include <node_cudf/utilities/stream.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/dictionary/encode.hpp>
+#include <cudf/filling.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/unary.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <memory>
+
+namespace nv {
+
+ObjectUnwrap<Column> Column::encode_dictionary(cudf::data_type indices_type,
+                                               rmm::mr::device_memory_resource* mr) const {
+  NODE_CUDF_EXPECT(type().id() != cudf::type_id::DICTIONARY32,
+                   "Column is already dictionary-encoded",
+                   Env());
+  NODE_CUDF_EXPECT(cudf::is_unsigned(indices_type) && cudf::is_index_type(indices_type),
+                   "Dictionary indices must be an unsigned integer type",
+                   Env());
+  return Column::New(cudf::dictionary::encode(*this, indices_type, mr));
+}
+
+ObjectUnwrap<Column> Column::decode_dictionary(rmm::mr::device_memory_resource* mr) const {
+  NODE_CUDF_EXPECT(
+    type().id() == cudf::type_id::DICTIONARY32, "Column is not dictionary-encoded", Env());
+  return Column::New(cudf::dictionary::decode(cudf::dictionary_column_view{*this}, mr));
+}
+
+ObjectUnwrap<Column> Column::make_dictionary(Column const& keys,
+                                             Column const& indices,
+                                             rmm::mr::device_memory_resource* mr) {
+  auto env = keys.Env();
+  NODE_CUDF_EXPECT(keys.null_count() == 0, "Dictionary keys must not contain nulls", env);
+  NODE_CUDF_EXPECT(
+    cudf::is_index_type(indices.type()), "Dictionary indices must be an integer type", env);
+
+  // Codes are gathered from without a bounds check, so every valid index must name a key
+  if (indices.size() > indices.null_count()) {
+    auto const stream  = get_current_stream();
+    auto const as_i64  = cudf::cast(indices, cudf::data_type{cudf::type_id::INT64}, mr);
+    auto const bounds  = cudf::minmax(*as_i64, mr);
+    auto const min_idx = static_cast<cudf::numeric_scalar<int64_t>*>(bounds.first.get());
+    auto const max_idx = static_cast<cudf::numeric_scalar<int64_t>*>(bounds.second.get());
+    NODE_CUDF_EXPECT(min_idx->value(stream) >= 0 && max_idx->value(stream) < keys.size(),
+                     "Dictionary indices must be in the range [0, keys.length)",
+                     env);
+  }
+
+  auto const keys_view = cudf::table_view{{keys}};
+  auto const idx_type  = cudf::data_type{cudf::type_id::UINT32};
+
+  std::unique_ptr<cudf::column> sorted_keys;
+  std::unique_ptr<cudf::column> codes;
+
+  if (cudf::is_sorted(keys_view, {}, {})) {
+    sorted_keys = std::make_unique<cudf::column>(keys.view(), get_current_stream(), mr);
+    codes       = cudf::cast(indices, idx_type, mr);
+  } else {
+    // Sort the keys, then remap each index to its key's position in the sorted keys
+    auto order = cudf::sorted_order(keys_view, {}, {}, mr);
+    sorted_keys =
+      std::move(cudf::gather(keys_view, *order, cudf::out_of_bounds_policy::DONT_CHECK, mr)
+                  ->release()[0]);
+    auto positions = cudf::sequence(keys.size(), cudf::numeric_scalar<cudf::size_type>(0), mr);
+    auto remap     = std::move(cudf::scatter(cudf::table_view{{*positions}},
+                                         *order,
+                                         cudf::table_view{{*positions}},
+                                         false,
+                                         mr)
+                             ->release()[0]);
+    auto gathered  = std::move(cudf::gather(cudf::table_view{{*remap}},
+                                           indices,
+                                           cudf::out_of_bounds_policy::NULLIFY,
+                                           mr)
+                                ->release()[0]);
+    codes          = cudf::cast(*gathered, idx_type, mr);
+  }
+
+  // Nulls live in the dictionary column's null mask, so the indices child is non-nullable
+  auto const size = codes->size();
+  auto contents   = codes->release();
+  return Column::New(cudf::make_dictionary_column(
+    std::move(sorted_keys),
+    std::make_unique<cudf::column>(idx_type, size, std::move(*contents.data)),
+    cudf::copy_bitmask(indices, mr),
+    indices.null_count()));
+}
+
+Napi::Value Column::encode_dictionary(Napi::CallbackInfo const& info) {
+  auto indices_type = info[0].IsUndefined() || info[0].IsNull()
+                        ? cudf::data_type{cudf::type_id::UINT32}
+                        : NapiToCPP(info[0]).operator cudf::data_type();
+  return encode_dictionary(indices_type, NapiToCPP(info[1]));
+}
+
+Napi::Value Column::decode_dictionary(Napi::CallbackInfo const& info) {
+  return decode_dictionary(NapiToCPP(info[0]).operator rmm::mr::device_memory_resource*());
+}
+
+Napi::Value Column::make_dictionary(Napi::CallbackInfo const& info) {
+  NODE_CUDF_EXPECT(Column::is_instance(info[0]) && Column::is_instance(info[1]),
+                   "makeDictionary expects keys and indices Columns",
+                   info.Env());
+  return make_dictionary(*Column::Unwrap(info[0].ToObject()),
+                         *Column::Unwrap(info[1].ToObject()),
+                         NapiToCPP(info[2]));
+}
+
+}  // namespace nv
@@ -23,7 +23,6 @@ import {
   // DateMillisecond,
   // Decimal,
   // DenseUnion,
-  // Dictionary,
   // FixedSizeBinary,
   // FixedSizeList,
   // Float16,
@@ -171,7 +170,10 @@ class VectorToColumnVisitor extends arrow.Visitor {
   }
   // visitDenseUnion<T extends arrow.DenseUnion>(vector: arrow.Vector<T>) {}
   // visitSparseUnion<T extends arrow.SparseUnion>(vector: arrow.Vector<T>) {}
-  // visitDictionary<T extends arrow.Dictionary>(vector: arrow.Vector<T>) {}
+  visitDictionary<T extends arrow.Dictionary>(vector: arrow.Vector<T>) {
+    const {indices, dictionary} = vector as any as arrow.DictionaryVector<T['valueType']>;
+    return Column.makeDictionary(this.visit(dictionary), this.visit(indices));
+  }
   // visitIntervalDayTime<T extends arrow.IntervalDayTime>(vector: arrow.Vector<T>) {}
   // visitIntervalYearMonth<T extends arrow.IntervalYearMonth>(vector: arrow.Vector<T>) {}
   // visitFixedSizeList<T extends arrow.FixedSizeList>(vector: arrow.Vector<T>) {}
@@ -16,13 +16,20 @@
 #include <node_cudf/scalar.hpp>
 #include <node_cudf/utilities/dtypes.hpp>
 #include <node_cudf/utilities/napi_to_cpp.hpp>
+#include <node_cudf/utilities/stream.hpp>
 #include <nv_node/utilities/args.hpp>
+#include <nv_node/utilities/cpp_to_napi.hpp>
 #include <nv_node/utilities/napi_to_cpp.hpp>
 
 #include <cudf/aggregation.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/quantiles.hpp>
 #include <cudf/reduction.hpp>
+#include <cudf/sorting.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <memory>
@@ -44,13 +51,49 @@ cudf::data_type _compute_dtype(cudf::type_id id) {
     default: return cudf::data_type{cudf::type_id::FLOAT64};
   }
 }
+
+bool _supports_minmax(cudf::data_type const& type) {
+  return type.id() == cudf::type_id::STRING || cudf::is_fixed_width(type);
+}
 }  // namespace
 
+bool Column::is_sorted() const {
+  if (is_sorted_ < 0) {
+    is_sorted_ = cudf::is_sorted(
+      cudf::table_view{{*this}}, {cudf::order::ASCENDING}, {cudf::null_order::BEFORE});
+  }
+  return is_sorted_ == 1;
+}
+
 std::pair<ObjectUnwrap<Scalar>, ObjectUnwrap<Scalar>> Column::minmax(
   rmm::mr::device_memory_resource* mr) const {
-  auto result = cudf::minmax(*this, mr);
-  return {Scalar::New(std::move(result.first)),  //
-          Scalar::New(std::move(result.second))};
+  if (min_.IsEmpty() || max_.IsEmpty()) {
+    auto result = cudf::minmax(*this, mr);
+    min_        = Scalar::New(std::move(result.first)).reference();
+    max_        = Scalar::New(std::move(result.second)).reference();
+  }
+  return {min_.Value(), max_.Value()};
+}
+
+Napi::Value Column::stats(Napi::CallbackInfo const& info) {
+  auto stats = Napi::Object::New(info.Env());
+  if (null_count_ > cudf::UNKNOWN_NULL_COUNT) { stats.Set("nullCount", null_count_); }
+  if (!min_.IsEmpty()) { stats.Set("min", Scalar::Unwrap(min_.Value())->get_value()); }
+  if (!max_.IsEmpty()) { stats.Set("max", Scalar::Unwrap(max_.Value())->get_value()); }
+  if (is_sorted_ >= 0) { stats.Set("isSorted", is_sorted_ == 1); }
+  if (distinct_count_[true] >= 0) { stats.Set("distinctCount", distinct_count_[true]); }
+  return stats;
+}
+
+Napi::Value Column::describe(Napi::CallbackInfo const& info) {
+  auto mr = NapiToCPP(info[0]).operator rmm::mr::device_memory_resource*();
+  null_count();
+  if (size() > 0 && _supports_minmax(type())) { minmax(mr); }
+  if (num_children() == 0 || type().id() == cudf::type_id::STRING) {
+    is_sorted();
+    nunique(true, mr);
+  }
+  return stats(info);
 }
 
 Napi::Value Column::min(Napi::CallbackInfo const& info) {
@@ -126,11 +169,14 @@ Napi::Value Column::median(Napi::CallbackInfo const& info) {
 }
 
 ObjectUnwrap<Scalar> Column::nunique(bool dropna, rmm::mr::device_memory_resource* mr) const {
+  auto const dtype = cudf::data_type{cudf::type_to_id<cudf::size_type>()};
+  auto& count      = distinct_count_[dropna];
+  if (count >= 0) { return Scalar::New(Napi::Number::New(Env(), count), dtype); }
   cudf::null_policy null_policy =
     (dropna == true) ? cudf::null_policy::EXCLUDE : cudf::null_policy::INCLUDE;
-  return reduce(cudf::make_nunique_aggregation(null_policy),
-                cudf::data_type{cudf::type_to_id<cudf::size_type>()},
-                mr);
+  auto result = reduce(cudf::make_nunique_aggregation(null_policy), dtype, mr);
+  count       = result->get_value().ToNumber().Int32Value();
+  return result;
 }
 
 Napi::Value Column::nunique(Napi::CallbackInfo const& info) {
@@ -169,4 +215,25 @@ Napi::Value Column::quantile(Napi::CallbackInfo const& info) {
   return quantile(args[0], args[1], args[2]);
 }
 
+ObjectUnwrap<Column> Column::quantiles(std::vector<double> const& q,
+                                       cudf::interpolation i,
+                                       rmm::mr::device_memory_resource* mr) const {
+  // Already-sorted columns without nulls can be used in their existing order
+  if (null_count() == 0 && is_sorted_ == 1) {
+    return Column::New(cudf::quantile(*this, q, i, {}, true, mr));
+  }
+  // Sort once for all the quantiles. Nulls are sorted last and excluded from the ordered indices.
+  auto order = cudf::detail::sorted_order(cudf::table_view{{*this}},
+                                          {cudf::order::ASCENDING},
+                                          {cudf::null_order::AFTER},
+                                          get_current_stream());
+  auto valid = cudf::slice(*order, {0, size() - null_count()}).front();
+  return Column::New(cudf::quantile(*this, q, i, valid, true, mr));
+}
+
+Napi::Value Column::quantiles(Napi::CallbackInfo const& info) {
+  CallbackArgs args{info};
+  return quantiles(args[0], args[1], args[2]);
+}
+
 }  // namespace nv
@@ -0,0 +1,135 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <node_cudf/column.hpp>
+#include <node_cudf/scalar.hpp>
+#include <node_cudf/utilities/error.hpp>
+#include <node_cudf/utilities/napi_to_cpp.hpp>
+
+#include <node_rmm/memory_resource.hpp>
+
+#include <cudf/binaryop.hpp>
+#include <cudf/filling.hpp>
+#include <cudf/rolling.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/search.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <napi.h>
+
+namespace nv {
+
+namespace {
+
+// The type of the range bounds for a range window over a column of type `type`
+cudf::data_type range_window_type(cudf::data_type const& type) {
+  switch (type.id()) {
+    case cudf::type_id::TIMESTAMP_DAYS: return cudf::data_type{cudf::type_id::DURATION_DAYS};
+    case cudf::type_id::TIMESTAMP_SECONDS: return cudf::data_type{cudf::type_id::DURATION_SECONDS};
+    case cudf::type_id::TIMESTAMP_MILLISECONDS:
+      return cudf::data_type{cudf::type_id::DURATION_MILLISECONDS};
+    case cudf::type_id::TIMESTAMP_MICROSECONDS:
+      return cudf::data_type{cudf::type_id::DURATION_MICROSECONDS};
+    case cudf::type_id::TIMESTAMP_NANOSECONDS:
+      return cudf::data_type{cudf::type_id::DURATION_NANOSECONDS};
+    default: return type;
+  }
+}
+
+}  // namespace
+
+ObjectUnwrap<Column> Column::rolling_window(cudf::size_type preceding_window,
+                                            cudf::size_type following_window,
+                                            cudf::size_type min_periods,
+                                            std::unique_ptr<cudf::aggregation> const& agg,
+                                            rmm::mr::device_memory_resource* mr) const {
+  try {
+    return Column::New(
+      cudf::rolling_window(*this, preceding_window, following_window, min_periods, agg, mr));
+  } catch (cudf::logic_error const& err) { NAPI_THROW(Napi::Error::New(Env(), err.what())); }
+}
+
+ObjectUnwrap<Column> Column::rolling_window(Column const& preceding_window,
+                                            Column const& following_window,
+                                            cudf::size_type min_periods,
+                                            std::unique_ptr<cudf::aggregation> const& agg,
+                                            rmm::mr::device_memory_resource* mr) const {
+  try {
+    return Column::New(
+      cudf::rolling_window(*this, preceding_window, following_window, min_periods, agg, mr));
+  } catch (cudf::logic_error const& err) { NAPI_THROW(Napi::Error::New(Env(), err.what())); }
+}
+
+ObjectUnwrap<Column> Column::range_rolling_window(Column const& orderby,
+                                                  Scalar const& preceding,
+                                                  Scalar const& following,
+                                                  cudf::size_type min_periods,
+                                                  std::unique_ptr<cudf::aggregation> const& agg,
+                                                  rmm::mr::device_memory_resource* mr) const {
+  NODE_CUDF_EXPECT(orderby.size() == size(), "orderby column must be the same size", Env());
+  NODE_CUDF_EXPECT(orderby.null_count() == 0, "orderby column must not contain nulls", Env());
+  try {
+    using cudf::binary_operator;
+    auto const order = std::vector<cudf::order>{cudf::order::ASCENDING};
+    auto const nulls = std::vector<cudf::null_order>{cudf::null_order::BEFORE};
+    auto const i32   = cudf::data_type{cudf::type_id::INT32};
+    auto const keys  = cudf::table_view{{orderby}};
+    // The window of row `i` spans from the first row >= (orderby[i] - preceding) to the last
+    // row <= (orderby[i] + following), both found with a binary search over `orderby`.
+    auto lo    = cudf::binary_operation(orderby, preceding, binary_operator::SUB, orderby.type());
+    auto hi    = cudf::binary_operation(orderby, following, binary_operator::ADD, orderby.type());
+    auto first = cudf::lower_bound(keys, cudf::table_view{{*lo}}, order, nulls);
+    auto last  = cudf::upper_bound(keys, cudf::table_view{{*hi}}, order, nulls);
+    // 1-based row numbers, since the preceding window includes the current row
+    auto one = cudf::numeric_scalar<int32_t>(1);
+    auto row = cudf::sequence(size(), one, one);
+    auto preceding_window = cudf::binary_operation(*row, *first, binary_operator::SUB, i32);
+    auto following_window = cudf::binary_operation(*last, *row, binary_operator::SUB, i32);
+    return Column::New(
+      cudf::rolling_window(*this, *preceding_window, *following_window, min_periods, agg, mr));
+  } catch (cudf::logic_error const& err) { NAPI_THROW(Napi::Error::New(Env(), err.what())); }
+}
+
+Napi::Value Column::rolling_window(Napi::CallbackInfo const& info) {
+  CallbackArgs args{info};
+  std::unique_ptr<cudf::aggregation> agg = args[0];
+  cudf::size_type min_periods            = args[3];
+  rmm::mr::device_memory_resource* mr    = args[4];
+  if (Column::is_instance(args[1]) && Column::is_instance(args[2])) {
+    auto& preceding = *Column::Unwrap(info[1].ToObject());
+    auto& following = *Column::Unwrap(info[2].ToObject());
+    return rolling_window(preceding, following, min_periods, agg, mr);
+  }
+  cudf::size_type preceding = args[1];
+  cudf::size_type following = args[2];
+  return rolling_window(preceding, following, min_periods, agg, mr);
+}
+
+Napi::Value Column::range_rolling_window(Napi::CallbackInfo const& info) {
+  CallbackArgs args{info};
+  if (!Column::is_instance(info[1])) {
+    NAPI_THROW(Napi::Error::New(info.Env(), "rollingRange orderBy argument expects a Column"));
+  }
+  std::unique_ptr<cudf::aggregation> agg = args[0];
+  auto& orderby                          = *Column::Unwrap(info[1].ToObject());
+  auto const type                        = range_window_type(orderby.type());
+  auto preceding                         = Scalar::New(info[2], type);
+  auto following                         = Scalar::New(info[3], type);
+  cudf::size_type min_periods            = args[4];
+  rmm::mr::device_memory_resource* mr    = args[5];
+  return range_rolling_window(orderby, *preceding, *following, min_periods, agg, mr);
+}
+
+}  // namespace nv
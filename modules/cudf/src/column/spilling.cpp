@@ -0,0 +1,125 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <node_cudf/column.hpp>
+#include <node_cudf/spill_manager.hpp>
+#include <node_cudf/utilities/stream.hpp>
+#include <node_rmm/device_buffer.hpp>
+
+#include <node_cuda/utilities/error.hpp>
+
+#include <cuda_runtime_api.h>
+#include <napi.h>
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace nv {
+
+void Column::set_spillable(bool spillable) {
+  spillable_ = spillable;
+  if (spillable) {
+    SpillManager::get().touch(*this);
+  } else {
+    SpillManager::get().untrack(*this);
+    unspill();
+  }
+  auto children = children_.Value().As<Napi::Array>();
+  for (auto i = 0u; i < children.Length(); ++i) {
+    Column::Unwrap(children.Get(i).As<Napi::Object>())->set_spillable(spillable);
+  }
+}
+
+bool Column::is_shared() const {
+  auto const is_shared = [](DeviceBuffer const& buffer) {
+    return buffer.is_view() || buffer.num_views() > 0 || buffer.num_shares() > 1;
+  };
+  return is_shared(*DeviceBuffer::Unwrap(data_.Value())) ||
+         is_shared(*DeviceBuffer::Unwrap(null_mask_.Value()));
+}
+
+std::vector<DeviceBuffer::Share> Column::share() const {
+  std::vector<DeviceBuffer::Share> shares{};
+  shares.push_back(DeviceBuffer::Unwrap(data_.Value())->share());
+  shares.push_back(DeviceBuffer::Unwrap(null_mask_.Value())->share());
+  for (cudf::size_type i = 0; i < num_children(); ++i) {
+    auto child_shares = child(i).share();
+    std::move(child_shares.begin(), child_shares.end(), std::back_inserter(shares));
+  }
+  return shares;
+}
+
+std::size_t Column::device_bytes() const {
+  if (is_shared()) { return 0; }
+  return DeviceBuffer::Unwrap(data_.Value())->size() +
+         DeviceBuffer::Unwrap(null_mask_.Value())->size();
+}
+
+std::size_t Column::spill() const {
+  if (is_spilled() || is_shared()) { return 0; }
+  auto& data      = DeviceBuffer::Unwrap(data_.Value())->buffer();
+  auto& mask      = DeviceBuffer::Unwrap(null_mask_.Value())->buffer();
+  auto const size = data.size() + mask.size();
+  // The copies out and the frees below are ordered only on each buffer's own stream, so wait for
+  // work on the current stream that may still be reading or writing them
+  NODE_CUDA_TRY(cudaStreamSynchronize(get_current_stream().value()), Env());
+  if (data.size() > 0) {
+    spilled_data_ = std::make_unique<SpilledBuffer>(Env(), data);
+    data.resize(0, data.stream());
+    data.shrink_to_fit(data.stream());
+  }
+  if (mask.size() > 0) {
+    spilled_mask_ = std::make_unique<SpilledBuffer>(Env(), mask);
+    mask.resize(0, mask.stream());
+    mask.shrink_to_fit(mask.stream());
+  }
+  // DeviceBuffer::Finalize releases only the size left at the time, so account for it here
+  Napi::MemoryManagement::AdjustExternalMemory(Env(), -static_cast<int64_t>(size));
+  return size;
+}
+
+void Column::unspill_buffers() const {
+  if (spilled_data_ != nullptr) {
+    spilled_data_->copy_to(Env(), DeviceBuffer::Unwrap(data_.Value())->buffer());
+    Napi::MemoryManagement::AdjustExternalMemory(Env(), spilled_data_->size());
+    spilled_data_.reset();
+  }
+  if (spilled_mask_ != nullptr) {
+    spilled_mask_->copy_to(Env(), DeviceBuffer::Unwrap(null_mask_.Value())->buffer());
+    Napi::MemoryManagement::AdjustExternalMemory(Env(), spilled_mask_->size());
+    spilled_mask_.reset();
+  }
+  if (spillable_) { SpillManager::get().touch(*this); }
+}
+
+Napi::Value Column::spillable(Napi::CallbackInfo const& info) {
+  return Napi::Boolean::New(info.Env(), spillable());
+}
+
+void Column::spillable(Napi::CallbackInfo const& info, Napi::Value const& value) {
+  set_spillable(value.ToBoolean());
+}
+
+Napi::Value Column::spilled(Napi::CallbackInfo const& info) {
+  return Napi::Boolean::New(info.Env(), is_spilled());
+}
+
+Napi::Value Column::spill(Napi::CallbackInfo const& info) {
+  return Napi::Number::New(info.Env(), SpillManager::get().spill_column(*this));
+}
+
+}  // namespace nv
@@ -13,11 +13,13 @@
 // limitations under the License.
 
 #include <node_cudf/column.hpp>
+#include <node_cudf/utilities/stream.hpp>
 #include <node_rmm/device_buffer.hpp>
 #include <nv_node/utilities/wrap.hpp>
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/detail/stream_compaction.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table_view.hpp>
@@ -32,14 +34,16 @@ namespace nv {
 
 ObjectUnwrap<Column> Column::apply_boolean_mask(Column const& boolean_mask,
                                                 rmm::mr::device_memory_resource* mr) const {
-  auto result = cudf::apply_boolean_mask(cudf::table_view{{*this}}, boolean_mask, mr);
+  auto result = cudf::detail::apply_boolean_mask(
+    cudf::table_view{{*this}}, boolean_mask, get_current_stream(), mr);
   std::vector<std::unique_ptr<cudf::column>> contents = result->release();
   return Column::New(std::move(contents[0]));
 }
 
 ObjectUnwrap<Column> Column::drop_nulls(rmm::mr::device_memory_resource* mr) const {
   std::vector<cudf::size_type> keys{0};
-  auto result = cudf::drop_nulls(cudf::table_view{{*this}}, keys, mr);
+  auto result = cudf::detail::drop_nulls(
+    cudf::table_view{{*this}}, keys, keys.size(), get_current_stream(), mr);
   std::vector<std::unique_ptr<cudf::column>> contents = result->release();
   return Column::New(std::move(contents[0]));
 }
@@ -50,7 +54,8 @@ Napi::Value Column::drop_nulls(Napi::CallbackInfo const& info) {
 
 ObjectUnwrap<Column> Column::drop_nans(rmm::mr::device_memory_resource* mr) const {
   std::vector<cudf::size_type> keys{0};
-  auto result = cudf::drop_nans(cudf::table_view{{*this}}, keys, mr);
+  auto result = cudf::detail::drop_nans(
+    cudf::table_view{{*this}}, keys, keys.size(), get_current_stream(), mr);
   std::vector<std::unique_ptr<cudf::column>> contents = result->release();
   return Column::New(std::move(contents[0]));
 }
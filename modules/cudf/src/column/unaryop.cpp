@@ -14,9 +14,11 @@
 
 #include <node_cudf/column.hpp>
 #include <node_cudf/utilities/napi_to_cpp.hpp>
+#include <node_cudf/utilities/stream.hpp>
 
 #include <node_rmm/memory_resource.hpp>
 
+#include <cudf/detail/unary.hpp>
 #include <cudf/unary.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
@@ -26,7 +28,7 @@ namespace nv {
 ObjectUnwrap<Column> Column::cast(cudf::data_type out_type,
                                   rmm::mr::device_memory_resource* mr) const {
   try {
-    return Column::New(cudf::cast(*this, out_type, mr));
+    return Column::New(cudf::detail::cast(*this, out_type, get_current_stream(), mr));
   } catch (cudf::logic_error const& err) { NAPI_THROW(Napi::Error::New(Env(), err.what())); }
 }
 
@@ -44,20 +46,20 @@ ObjectUnwrap<Column> Column::is_valid(rmm::mr::device_memory_resource* mr) const
 
 ObjectUnwrap<Column> Column::is_nan(rmm::mr::device_memory_resource* mr) const {
   try {
-    return Column::New(cudf::is_nan(*this, mr));
+    return Column::New(cudf::detail::is_nan(*this, get_current_stream(), mr));
   } catch (cudf::logic_error const& err) { NAPI_THROW(Napi::Error::New(Env(), err.what())); }
 }
 
 ObjectUnwrap<Column> Column::is_not_nan(rmm::mr::device_memory_resource* mr) const {
   try {
-    return Column::New(cudf::is_not_nan(*this, mr));
+    return Column::New(cudf::detail::is_not_nan(*this, get_current_stream(), mr));
   } catch (cudf::logic_error const& err) { NAPI_THROW(Napi::Error::New(Env(), err.what())); }
 }
 
 ObjectUnwrap<Column> Column::unary_operation(cudf::unary_operator op,
                                              rmm::mr::device_memory_resource* mr) const {
   try {
-    return Column::New(cudf::unary_operation(*this, op, mr));
+    return Column::New(cudf::detail::unary_operation(*this, op, get_current_stream(), mr));
   } catch (cudf::logic_error const& err) { NAPI_THROW(Napi::Error::New(Env(), err.what())); }
 }
 
@@ -0,0 +1,172 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import * as arrow from 'apache-arrow';
+import {createHash} from 'crypto';
+import * as fs from 'fs';
+
+import {Table} from './table';
+import {CSVType, CSVTypeMap, ReadCSVOptions} from './types/csv';
+import {DataType} from './types/dtypes';
+
+export interface CSVSchemaCacheOptions {
+  /**
+   * How to identify files with the same layout. `'file'` (the default) keys each file by its path,
+   * size, and modification time. `'header'` keys each file by a hash of its header line, so
+   * different files with identical headers share a schema. Buffers are always keyed by header.
+   */
+  keyBy?: 'file'|'header';
+}
+
+/**
+ * Caches the column names and dtypes `readCSV` infers, so later reads of sources with the same
+ * layout pass them as `dataTypes` and skip type inference.
+ *
+ * @example
+ * ```typescript
+ * import {CSVSchemaCache, DataFrame} from '@nvidia/cudf';
+ *
+ * const schemaCache = CSVSchemaCache.fromJSON(fs.readFileSync('schemas.json', 'utf8'));
+ * const df = DataFrame.readCSV({sourceType: 'files', sources: [path], schemaCache});
+ * fs.writeFileSync('schemas.json', schemaCache.toJSON());
+ * ```
+ */
+export class CSVSchemaCache {
+  /**
+   * Create a CSVSchemaCache from the output of `toJSON()`.
+   *
+   * @param json The serialized cache.
+   * @param options Settings for how sources are identified.
+   */
+  static fromJSON(json: string, options: CSVSchemaCacheOptions = {}) {
+    const cache = new CSVSchemaCache(options);
+    for (const [key, dataTypes] of Object.entries(JSON.parse(json) as Record<string, CSVTypeMap>)) {
+      cache._schemas.set(key, dataTypes);
+    }
+    return cache;
+  }
+
+  private readonly _keyBy: 'file'|'header';
+  private readonly _schemas = new Map<string, CSVTypeMap>();
+
+  /** The number of reads that used a cached schema */
+  public hits = 0;
+  /** The number of reads that inferred their schema */
+  public misses = 0;
+
+  constructor({keyBy = 'file'}: CSVSchemaCacheOptions = {}) { this._keyBy = keyBy; }
+
+  /** The number of cached schemas */
+  get size() { return this._schemas.size; }
+
+  /** Remove every cached schema */
+  clear() { this._schemas.clear(); }
+
+  /**
+   * Serialize the cached schemas to a JSON string.
+   */
+  toJSON() {
+    const schemas: Record<string, CSVTypeMap> = {};
+    this._schemas.forEach((dataTypes, key) => { schemas[key] = dataTypes; });
+    return JSON.stringify(schemas);
+  }
+
+  /**
+   * Read a CSV dataset, using the cached schema for its sources if there is one. Reads without
+   * `dataTypes` or `columnsToReturn` cache the schema they infer.
+   *
+   * @param options Settings for controlling reading behavior.
+   */
+  readCSV<T extends CSVTypeMap = any>(options: ReadCSVOptions<T>):
+    {names: (keyof T)[], table: Table} {
+    if (options.dataTypes) { return Table.readCSV(options); }
+
+    const key    = this._key(options);
+    const cached = key !== undefined ? this._schemas.get(key) : undefined;
+
+    if (cached) {
+      ++this.hits;
+      // Explicit names disable header inference, so read the header row the inferring read used
+      const {header = 'infer'} = options;
+      return Table.readCSV<T>({
+        ...options,
+        dataTypes: cached as T,
+        header: header === 'infer' ? 0 : header,
+      });
+    }
+
+    ++this.misses;
+    const result = Table.readCSV<T>(options);
+    if (key !== undefined && !options.columnsToReturn) {
+      const dataTypes = inferredDataTypes(result.names as string[], result.table);
+      if (dataTypes) { this._schemas.set(key, dataTypes); }
+    }
+    return result;
+  }
+
+  protected _key<T extends CSVTypeMap>(options: ReadCSVOptions<T>) {
+    const lineTerminator = options.lineTerminator ?? '\n';
+    const compressed     = options.compression !== undefined && options.compression !== 'infer';
+    const keys           = options.sourceType === 'buffers'
+                   ? options.sources.map((buffer) => headerHash(buffer, lineTerminator))
+                   : options.sources.map((path) => (this._keyBy === 'header' && !compressed)
+                                                     ? headerHash(readHead(path), lineTerminator)
+                                                     : fileKey(path));
+    // Options that change how columns are named or typed are part of the key
+    const {header, prefix, delimiter, datetimeColumns} = options;
+    return JSON.stringify([keys, header, prefix, delimiter, datetimeColumns]);
+  }
+}
+
+function fileKey(path: string) {
+  const {size, mtimeMs} = fs.statSync(path);
+  return `${path}:${size}:${mtimeMs}`;
+}
+
+function readHead(path: string, length = 64 * 1024) {
+  const fd = fs.openSync(path, 'r');
+  try {
+    const buffer = Buffer.alloc(length);
+    return buffer.subarray(0, fs.readSync(fd, buffer, 0, length, 0));
+  } finally { fs.closeSync(fd); }
+}
+
+function headerHash(buffer: Uint8Array, lineTerminator: string) {
+  const bytes = Buffer.from(buffer.buffer, buffer.byteOffset, buffer.byteLength);
+  const end   = bytes.indexOf(lineTerminator);
+  return createHash('sha1').update(end < 0 ? bytes : bytes.subarray(0, end)).digest('hex');
+}
+
+function inferredDataTypes(names: string[], table: Table) {
+  const dataTypes: CSVTypeMap = {};
+  for (let i = -1; ++i < names.length;) {
+    const type = toCSVType(table.getColumnByIndex(i).type);
+    if (type === undefined) { return undefined; }
+    dataTypes[names[i]] = type;
+  }
+  return dataTypes;
+}
+
+function toCSVType(type: DataType): CSVType|undefined {
+  switch (type.typeId) {
+    case arrow.Type.Int:
+      return `${(type as arrow.Int).isSigned ? 'int' : 'uint'}${(type as arrow.Int).bitWidth}` as
+             CSVType;
+    case arrow.Type.Float:
+      return (type as arrow.Float).precision === arrow.Precision.SINGLE ? 'float32' : 'float64';
+    case arrow.Type.Bool: return 'bool';
+    case arrow.Type.Utf8: return 'str';
+  }
+  return undefined;
+}
@@ -18,21 +18,27 @@ import {Readable} from 'stream';
 
 import {Column} from './column';
 import {ColumnAccessor} from './column_accessor'
+import {DataFrameScan} from './data_frame_scan';
+import {HashJoinIndex} from './hash_join';
 import {AbstractSeries, Float32Series, Float64Series, Series} from './series';
 import {Table} from './table';
 import {CSVToCUDFType, CSVTypeMap, ReadCSVOptions, WriteCSVOptions} from './types/csv';
 import {
   Bool8,
   DataType,
+  Float64,
   IndexType,
+  Int32,
 } from './types/dtypes'
 import {
   NullOrder,
 } from './types/enums';
 import {
   ColumnsMap,
+  Interpolation,
   TypeMap,
 } from './types/mappings';
+import {ReadParquetOptions} from './types/parquet';
 
 export type SeriesMap<T extends TypeMap> = {
   [P in keyof T]: AbstractSeries<T[P]>
@@ -43,6 +49,40 @@ export type OrderSpec = {
   null_order: NullOrder
 };
 
+export type JoinType = 'inner'|'left'|'outer'|'leftsemi'|'leftanti';
+
+export type JoinOptions<TOn extends string> = {
+  /** Names of the key columns to join on. */
+  on: TOn[];
+  /** The type of join to perform (default 'inner'). */
+  how?: JoinType;
+  /** Suffix appended to left non-key column names that collide with right names (default ''). */
+  lsuffix?: string;
+  /**
+   * Suffix appended to right non-key column names that collide with left names (default
+   * '_right').
+   */
+  rsuffix?: string;
+  /** Whether null keys are considered equal (default true). */
+  nullEquality?: boolean;
+  /**
+   * A prebuilt hash table on the right DataFrame's `on` columns (see `DataFrame.joinIndex()`).
+   * Reusing an index skips rebuilding the hash table for each join against the same right
+   * DataFrame. The index must have been built by `other.joinIndex(on)`, over the same key
+   * columns and with the same `nullEquality`. Ignored for 'leftsemi' and 'leftanti' joins.
+   */
+  index?: HashJoinIndex;
+  /**
+   * The optional MemoryResource used to allocate the result DataFrame's device memory.
+   */
+  memoryResource?: MemoryResource;
+};
+
+function minRows(...numRows: (number|undefined)[]) {
+  const limits = numRows.filter((n): n is number => n != null && n >= 0);
+  return limits.length > 0 ? Math.min(...limits) : undefined;
+}
+
 function _seriesToColumns<T extends TypeMap>(data: SeriesMap<T>) {
   const columns = {} as any;
   for (const [name, series] of Object.entries(data)) { columns[name] = series._col; }
@@ -54,12 +94,55 @@ function _seriesToColumns<T extends TypeMap>(data: SeriesMap<T>) {
  */
 export class DataFrame<T extends TypeMap = any> {
   public static readCSV<T extends CSVTypeMap = any>(options: ReadCSVOptions<T>) {
-    const {names, table} = Table.readCSV(options);
+    const {names, table} =
+      options.schemaCache ? options.schemaCache.readCSV(options) : Table.readCSV(options);
     return new DataFrame(new ColumnAccessor(
       names.reduce((map, name, i) => ({...map, [name]: table.getColumnByIndex(i)}),
                    {} as ColumnsMap<{[P in keyof T]: CSVToCUDFType<T[P]>}>)));
   }
 
+  /**
+   * Read a Parquet dataset into a DataFrame.
+   *
+   * @param options Settings for controlling reading behavior.
+   */
+  public static readParquet<T extends TypeMap = any>(options: ReadParquetOptions) {
+    const {names, table} = Table.readParquet(options);
+    return new DataFrame(new ColumnAccessor(
+      names.reduce((map, name, i) => ({...map, [name]: table.getColumnByIndex(i)}),
+                   {} as ColumnsMap<T>)));
+  }
+
+  /**
+   * Lazily scan a CSV dataset. The `select`, `filter`, and `head` calls on the result are pushed
+   * down into `columnsToReturn` and `numRows` when it is collected.
+   *
+   * @param options Settings for controlling reading behavior.
+   */
+  public static scanCSV<T extends CSVTypeMap = any>(options: ReadCSVOptions<T>) {
+    return new DataFrameScan<{[P in keyof T]: CSVToCUDFType<T[P]>}>(({columns, numRows}) => {
+      const opts = {...options};
+      if (columns) { opts.columnsToReturn = columns; }
+      if ((numRows = minRows(options.numRows, numRows)) !== undefined) { opts.numRows = numRows; }
+      return DataFrame.readCSV(opts);
+    });
+  }
+
+  /**
+   * Lazily scan a Parquet dataset. The `select`, `filter`, and `head` calls on the result are
+   * pushed down into `columns` and `numRows` when it is collected.
+   *
+   * @param options Settings for controlling reading behavior.
+   */
+  public static scanParquet<T extends TypeMap = any>(options: ReadParquetOptions) {
+    return new DataFrameScan<T>(({columns, numRows}) => {
+      const opts = {...options};
+      if (columns) { opts.columns = columns; }
+      if ((numRows = minRows(options.numRows, numRows)) !== undefined) { opts.numRows = numRows; }
+      return DataFrame.readParquet<T>(opts);
+    });
+  }
+
   private _accessor: ColumnAccessor<T>;
 
   constructor(data: ColumnAccessor<T>|SeriesMap<T>) {
@@ -85,6 +168,18 @@ export class DataFrame<T extends TypeMap = any> {
   /** @ignore */
   asTable() { return new Table({columns: this._accessor.columns}); }
 
+  /**
+   * Allow or prevent the spill manager from moving this DataFrame's columns out of device memory.
+   *
+   * @param spillable Whether the columns may be spilled.
+   * @returns this DataFrame
+   * @see setSpillOptions
+   */
+  setSpillable(spillable = true) {
+    this._accessor.columns.forEach((col) => { col.spillable = spillable; });
+    return this;
+  }
+
   /**
    * Return a new DataFrame containing only specified columns.
    *
@@ -178,6 +273,84 @@ export class DataFrame<T extends TypeMap = any> {
     return Series.new(sorted_indices);
   }
 
+  /**
+   * Sort the rows of this DataFrame by the values of one or more columns in a single pass.
+   *
+   * @param options mapping of column names to sort order specifications
+   * @param stable whether rows with equal keys keep their relative order (default false)
+   * @param memoryResource The optional MemoryResource used to allocate the result DataFrame's
+   *   device memory.
+   *
+   * @returns DataFrame with its rows sorted
+   */
+  sortValues<R extends keyof T>(options: {[P in R]: OrderSpec},
+                                stable = false,
+                                memoryResource?: MemoryResource) {
+    const {keys, column_orders, null_orders} = this._sortKeys(options);
+    const values                             = this.asTable();
+    const result =
+      stable ? values.stableSortByKey(keys, column_orders, null_orders, memoryResource)
+             : values.sortByKey(keys, column_orders, null_orders, memoryResource);
+    return this._fromTable(result);
+  }
+
+  /**
+   * Return the first `k` rows ordered by the given columns in descending order. Nulls are sorted
+   * last. Only the selected rows are gathered.
+   *
+   * @param k The number of rows to return.
+   * @param names Names of the columns to order by.
+   * @param memoryResource The optional MemoryResource used to allocate the result DataFrame's
+   *   device memory.
+   */
+  nlargest<R extends keyof T>(k: number, names: R[], memoryResource?: MemoryResource) {
+    const keys = this.select(names).asTable();
+    return this._fromTable(this.asTable().topK(keys,
+                                               k,
+                                               names.map(() => false),
+                                               names.map(() => NullOrder.BEFORE),
+                                               memoryResource));
+  }
+
+  /**
+   * Return the first `k` rows ordered by the given columns in ascending order. Nulls are sorted
+   * last. Only the selected rows are gathered.
+   *
+   * @param k The number of rows to return.
+   * @param names Names of the columns to order by.
+   * @param memoryResource The optional MemoryResource used to allocate the result DataFrame's
+   *   device memory.
+   */
+  nsmallest<R extends keyof T>(k: number, names: R[], memoryResource?: MemoryResource) {
+    const keys = this.select(names).asTable();
+    return this._fromTable(this.asTable().topK(keys,
+                                               k,
+                                               names.map(() => true),
+                                               names.map(() => NullOrder.AFTER),
+                                               memoryResource));
+  }
+
+  /** @ignore */
+  _sortKeys<R extends keyof T>(options: {[P in R]: OrderSpec}) {
+    const column_orders = new Array<boolean>();
+    const null_orders   = new Array<NullOrder>();
+    const columns       = new Array<Column<T[keyof T]>>();
+    const entries       = Object.entries(options) as [R, OrderSpec][];
+    entries.forEach(([name, {ascending, null_order}]) => {
+      columns.push(this.get(name)._col as Column<T[keyof T]>);
+      column_orders.push(ascending);
+      null_orders.push(null_order);
+    });
+    return {keys: new Table({columns}), column_orders, null_orders};
+  }
+
+  /** @ignore */
+  _fromTable(table: Table) {
+    return new DataFrame(this.names.reduce(
+      (map, name, i) => ({...map, [name]: Series.new(table.getColumnByIndex(i))}),
+      {} as SeriesMap<T>));
+  }
+
   /**
    * Return sub-selection from a DataFrame from the specified indices
    *
@@ -206,6 +379,131 @@ export class DataFrame<T extends TypeMap = any> {
     return new DataFrame(series_map);
   }
 
+  /**
+   * Partition this DataFrame's rows by the hash of key columns. Rows with equal keys are in the
+   * same partition.
+   *
+   * The rows are partitioned in a single pass, and each partition is a zero-copy view of the
+   * partitioned rows, so partitions can be handed to workers without further copies.
+   *
+   * @param on Names of the key columns.
+   * @param numPartitions The number of partitions.
+   * @param memoryResource The optional MemoryResource used to allocate the partitions' device
+   *   memory.
+   * @returns An Array of `numPartitions` DataFrames.
+   */
+  hashPartition<R extends keyof T>(on: R[], numPartitions: number,
+                                   memoryResource?: MemoryResource) {
+    const names = this._accessor.names;
+    const keys  = on.map((name) => names.indexOf(name));
+    const {table, offsets} = this.asTable().hashPartition(keys, numPartitions, memoryResource);
+    return table.split(offsets.slice(1)).map((part) => new DataFrame(new ColumnAccessor(
+      names.reduce((map, name, i) => ({...map, [name]: part.getColumnByIndex(i)}),
+                   {} as ColumnsMap<T>))));
+  }
+
+  /**
+   * Build a reusable hash table on the rows of the given key columns. Pass the result as the
+   * `index` option of `join()` when this DataFrame is the right side of many joins.
+   *
+   * @param on Names of the key columns.
+   * @param nullEquality Whether null keys are considered equal (default true).
+   */
+  joinIndex<R extends keyof T>(on: R[], nullEquality = true) {
+    return new HashJoinIndex(this.select(on).asTable(), nullEquality);
+  }
+
+  /**
+   * Join columns with another DataFrame on the values of key columns.
+   *
+   * @param other The right DataFrame to join with.
+   * @param options Options controlling which keys are matched and how.
+   *
+   * @example
+   * ```typescript
+   * import {DataFrame, Series, Int32, Float32}  from '@nvidia/cudf';
+   * const lhs = new DataFrame({
+   *  "id": Series.new({type: new Int32, data: [0, 1, 2]}),
+   *  "a": Series.new({type: new Float32, data: [0.5, 1.5, 2.5]})
+   * });
+   * const rhs = new DataFrame({
+   *  "id": Series.new({type: new Int32, data: [1, 2, 3]}),
+   *  "b": Series.new({type: new Float32, data: [10, 20, 30]})
+   * });
+   * lhs.join(rhs, {on: ["id"]}); // returns df {id: [1, 2], a: [1.5, 2.5], b: [10, 20]}
+   * ```
+   */
+  join<R extends TypeMap, TOn extends string&keyof T&keyof R>(other: DataFrame<R>,
+                                                             options: JoinOptions<TOn>):
+    DataFrame<any> {
+    const {
+      on,
+      how = 'inner',
+      lsuffix = '',
+      rsuffix = '_right',
+      nullEquality = true,
+      index,
+      memoryResource,
+    } = options;
+
+    const lhsKeys = this.select(on).asTable();
+
+    if (how === 'leftsemi' || how === 'leftanti') {
+      const rhsKeys = other.select(on).asTable();
+      const map     = how === 'leftsemi'
+                        ? lhsKeys.leftSemiJoin(rhsKeys, nullEquality, memoryResource)
+                        : lhsKeys.leftAntiJoin(rhsKeys, nullEquality, memoryResource);
+      return this.gather(Series.new(map));
+    }
+
+    let maps: [Column<Int32>, Column<Int32>];
+    if (index) {
+      if (index.nullEquality !== nullEquality) {
+        throw new Error(`join index was built with nullEquality=${
+          String(index.nullEquality)}, but the join requested nullEquality=${
+          String(nullEquality)}`);
+      }
+      const {build} = index;
+      if (build.numColumns !== on.length ||
+          on.some((name, i) => build.getColumnByIndex(i) !== other._accessor.get(name))) {
+        throw new Error(`join index was not built over the '${on.join(`', '`)}' columns of other`);
+      }
+      maps = how === 'inner'  ? index.innerJoin(lhsKeys, memoryResource)
+             : how === 'left' ? index.leftJoin(lhsKeys, memoryResource)
+                              : index.fullJoin(lhsKeys, memoryResource);
+    } else {
+      const rhsKeys = other.select(on).asTable();
+      maps = how === 'inner'  ? lhsKeys.innerJoin(rhsKeys, nullEquality, memoryResource)
+             : how === 'left' ? lhsKeys.leftJoin(rhsKeys, nullEquality, memoryResource)
+                              : lhsKeys.fullJoin(rhsKeys, nullEquality, memoryResource);
+    }
+
+    const [lhsMap, rhsMap] = maps;
+    const lhsNames         = this.names as string[];
+    const rhsNames         = (other.names as string[]).filter((name) => !on.includes(name as TOn));
+    // Out-of-bounds indices mark rows without a match, which become nulls
+    const nullify = how !== 'inner';
+    const lhs     = this.asTable().gather(lhsMap, nullify);
+    const rhs     = other.select(rhsNames as (keyof R)[]).asTable().gather(rhsMap, nullify);
+
+    const columns = {} as any;
+    lhsNames.forEach((name, i) => {
+      let col = lhs.getColumnByIndex(i);
+      if (how === 'outer' && on.includes(name as TOn)) {
+        // Take the key from whichever side has it
+        const rhsKey =
+          other.select([name as TOn]).asTable().gather(rhsMap, nullify).getColumnByIndex(0);
+        col = col.coalesce(rhsKey, memoryResource);
+      }
+      columns[rhsNames.includes(name) ? `${name}${lsuffix}` : name] = Series.new(col);
+    });
+    rhsNames.forEach((name, i) => {
+      columns[lhsNames.includes(name) ? `${name}${rsuffix}` : name] =
+        Series.new(rhs.getColumnByIndex(i));
+    });
+    return new DataFrame(columns);
+  }
+
   /**
    * Serialize this DataFrame to CSV format.
    *
@@ -449,4 +747,93 @@ export class DataFrame<T extends TypeMap = any> {
     });
     return new DataFrame(series_map);
   }
+
+  /**
+   * Remove duplicate rows. The result is sorted by the `subset` columns.
+   *
+   * @param keep Which row of each set of duplicates to keep: 'first' (default), 'last', or
+   *   'none' to drop every duplicated row.
+   * @param nullsEqual Whether null keys are considered equal (default true).
+   * @param subset Names of the columns that identify duplicates (all columns by default).
+   * @param memoryResource The optional MemoryResource used to allocate the result DataFrame's
+   *   device memory.
+   *
+   * @example
+   * ```typescript
+   * import {DataFrame, Series, Int32}  from '@nvidia/cudf';
+   * const df = new DataFrame({
+   *  "a": Series.new({type: new Int32, data: [1, 1, 2, 2]}),
+   *  "b": Series.new({type: new Int32, data: [1, 1, 2, 3]})
+   * });
+   * df.dropDuplicates('first'); // {a: [1, 2, 2], b: [1, 2, 3]}
+   * df.dropDuplicates('none', true, ['a']); // {a: [], b: []}
+   * ```
+   */
+  dropDuplicates(keep: 'first'|'last'|'none' = 'first',
+                 nullsEqual                      = true,
+                 subset?: (keyof T)[],
+                 memoryResource?: MemoryResource): DataFrame<T> {
+    const names  = this._accessor.names;
+    const keys   = (subset ?? names).map((name) => names.indexOf(name));
+    const result = this.asTable().dropDuplicates(keys, keep, nullsEqual, memoryResource);
+    return new DataFrame(new ColumnAccessor(names.reduce(
+      (map, name, i) => ({...map, [name]: result.getColumnByIndex(i)}), {} as ColumnsMap<T>)));
+  }
+
+  /**
+   * Count the exact number of distinct rows.
+   *
+   * @param subset Names of the columns that identify a row (all columns by default).
+   * @param nullsEqual Whether null elements are considered equal (default true).
+   */
+  distinctCount(subset?: (keyof T)[], nullsEqual = true) {
+    const table = subset ? this.select(subset).asTable() : this.asTable();
+    return table.distinctCount(nullsEqual);
+  }
+
+  /**
+   * Generate descriptive statistics of the numeric columns of this DataFrame.
+   *
+   * The result has one Float64 column per numeric column, with 8 rows in the order:
+   * count, mean, std, min, 25%, 50%, 75%, max. Null values are excluded from each statistic.
+   *
+   * All the reductions are launched together and read back once, and the quantiles of each
+   * column are computed with a single sort.
+   *
+   * @param memoryResource The optional MemoryResource used to allocate temporary device memory.
+   *
+   * @example
+   * ```typescript
+   * import {DataFrame, Series}  from '@nvidia/cudf';
+   * const df = new DataFrame({a: Series.new([1, 2, 3, 4])});
+   *
+   * df.describe().get('a') // [4, 2.5, 1.2909944487358056, 1, 1.75, 2.5, 3.25, 4]
+   * ```
+   */
+  describe(memoryResource?: MemoryResource) {
+    const names = this.names.filter((name) => {
+      const {type} = this.get(name);
+      return arrow.DataType.isInt(type) || arrow.DataType.isFloat(type);
+    });
+    const table = this.select(names).asTable();
+    // A single native call launches every reduction and quantile over every column before
+    // copying any result back, so the device is only waited on once.
+    const stats = table.reduceAll(['count', 'mean', 'std', 'min', 'max'],
+                                  [0.25, 0.5, 0.75],
+                                  Interpolation.linear,
+                                  memoryResource);
+    const quantiles = stats.quantiles!;
+    const toNumber  = (x: any) => x == null ? null : Number(x);
+    return new DataFrame(names.reduce((map, name, i) => {
+      const data = [
+        stats.count[i],
+        stats.mean[i],
+        stats.std[i],
+        stats.min[i],
+        ...quantiles.map((q) => q[i]),
+        stats.max[i],
+      ];
+      return {...map, [name]: Series.new({type: new Float64, data: data.map(toNumber)})};
+    }, {} as SeriesMap<{[P in keyof T]: Float64}>));
+  }
 }
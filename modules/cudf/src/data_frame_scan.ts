@@ -0,0 +1,121 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import {ColumnAccessor} from './column_accessor';
+import {DataFrame} from './data_frame';
+import {Series} from './series';
+import {Bool8} from './types/dtypes';
+import {ColumnsMap, TypeMap} from './types/mappings';
+
+/**
+ * The reader options a DataFrameScan pushes down into its reader.
+ */
+export type ScanPushdown = {
+  /** Names of the columns to read, or undefined to read every column */
+  columns?: string[];
+  /** The maximum number of rows to read, or undefined to read every row */
+  numRows?: number;
+};
+
+type ScanStep = {type: 'select', names: string[]}|
+  {type: 'filter', names: string[], predicate: (df: DataFrame) => Series<Bool8>}|
+  {type: 'head', numRows: number};
+
+/**
+ * A lazy plan of `select`, `filter`, and `head` operations over a CSV or Parquet source.
+ *
+ * Nothing is read until `collect()` is called. The plan is then pushed down into the reader's
+ * options, so columns that are neither selected nor filtered on are never parsed or allocated,
+ * and rows after a leading `head()` are never read.
+ */
+export class DataFrameScan<T extends TypeMap = any> {
+  /** @ignore */
+  constructor(private readonly _read: (pushdown: ScanPushdown) => DataFrame,
+              private readonly _steps: ReadonlyArray<ScanStep> = []) {}
+
+  /**
+   * Keep only the specified columns.
+   *
+   * @param names Names of the columns to keep.
+   */
+  select<R extends keyof T>(names: R[]): DataFrameScan<{[P in R]: T[P]}> {
+    return new DataFrameScan(this._read, [...this._steps, {type: 'select', names: names as any}]);
+  }
+
+  /**
+   * Keep only the rows for which `predicate` returns true.
+   *
+   * @param names Names of the columns `predicate` reads.
+   * @param predicate Function returning a boolean mask from a DataFrame of the `names` columns.
+   */
+  filter<R extends keyof T>(names: R[],
+                            predicate: (df: DataFrame<{[P in R]: T[P]}>) => Series<Bool8>) {
+    return new DataFrameScan<T>(this._read,
+                                [...this._steps, {type: 'filter', names: names as any, predicate}]);
+  }
+
+  /**
+   * Keep only the first `numRows` rows.
+   *
+   * @param numRows The number of rows to keep.
+   */
+  head(numRows: number) {
+    return new DataFrameScan<T>(this._read, [...this._steps, {type: 'head', numRows}]);
+  }
+
+  /**
+   * The columns and number of rows that `collect()` will read.
+   */
+  get pushdown(): ScanPushdown {
+    let selected: string[]|undefined;
+    let numRows: number|undefined;
+    let filtered = false;
+    const filterNames = new Set<string>();
+    for (const step of this._steps) {
+      switch (step.type) {
+        case 'select': selected = step.names; break;
+        case 'filter':
+          filtered = true;
+          step.names.forEach((name) => filterNames.add(name));
+          break;
+        case 'head':
+          // Rows can only be limited in the reader if no filter runs before the head
+          if (!filtered) { numRows = Math.min(numRows ?? Infinity, step.numRows); }
+          break;
+      }
+    }
+    const columns = selected && [...new Set([...selected, ...filterNames])];
+    return {columns, numRows};
+  }
+
+  /**
+   * Read the source with the plan pushed down, then apply the plan to the result.
+   */
+  collect(): DataFrame<T> {
+    return this._steps.reduce((df, step) => {
+      switch (step.type) {
+        case 'select': return df.select(step.names);
+        case 'filter': return df.filter(step.predicate(df.select(step.names)));
+        case 'head': return step.numRows < df.numRows ? head(df, step.numRows) : df;
+      }
+    }, this._read(this.pushdown)) as DataFrame<T>;
+  }
+}
+
+function head<T extends TypeMap>(df: DataFrame<T>, numRows: number) {
+  const [table] = df.asTable().slice([0, numRows]);
+  return new DataFrame(new ColumnAccessor(
+    df.names.reduce((map, name, i) => ({...map, [name]: table.getColumnByIndex(i)}),
+                    {} as ColumnsMap<T>)));
+}
@@ -17,7 +17,11 @@
 #include "node_cudf/utilities/error.hpp"
 #include "node_cudf/utilities/napi_to_cpp.hpp"
 
+#include <cudf/column/column_factories.hpp>
+#include <cudf/filling.hpp>
 #include <cudf/groupby.hpp>
+#include <cudf/rolling.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/types.hpp>
 #include <node_cuda/utilities/error.hpp>
 
@@ -50,6 +54,8 @@ Napi::Object GroupBy::Init(Napi::Env env, Napi::Object exports) {
                                       InstanceMethod<&GroupBy::sum>("_sum"),
                                       InstanceMethod<&GroupBy::var>("_var"),
                                       InstanceMethod<&GroupBy::quantile>("_quantile"),
+                                      // window functions
+                                      InstanceMethod<&GroupBy::rolling>("_rolling"),
                                     });
 
   GroupBy::constructor = Napi::Persistent(ctor);
@@ -74,7 +80,9 @@ GroupBy::GroupBy(CallbackArgs const& args) : Napi::ObjectWrap<GroupBy>(args) {
     NAPI_THROW(Napi::Error::New(args.Env(), "GroupBy constructor 'keys' field expects a Table."));
   }
 
-  cudf::table_view table_view = Table::Unwrap(props.Get("keys").ToObject())->view();
+  auto const& keys            = *Table::Unwrap(props.Get("keys").ToObject());
+  cudf::table_view table_view = keys.view();
+  keys_shares_                = keys.share();
 
   auto null_handling = null_policy::EXCLUDE;
   if (props.Has("include_nulls")) { null_handling = NapiToCPP(props.Get("include_nulls")); }
@@ -92,7 +100,10 @@ GroupBy::GroupBy(CallbackArgs const& args) : Napi::ObjectWrap<GroupBy>(args) {
     table_view, null_handling, keys_are_sorted, column_order, null_precedence));
 }
 
-void GroupBy::Finalize(Napi::Env env) { this->groupby_.reset(nullptr); }
+void GroupBy::Finalize(Napi::Env env) {
+  this->groupby_.reset(nullptr);
+  this->keys_shares_.clear();
+}
 
 //
 // Private API
@@ -226,8 +237,7 @@ Napi::Value GroupBy::var(Napi::CallbackInfo const& info) {
 Napi::Value GroupBy::quantile(Napi::CallbackInfo const& info) {
   CallbackArgs args{info};
 
-  double q = args[0];
-  std::vector<double> qs{q};
+  std::vector<double> qs = args[0];
 
   auto values = args[1];
   NODE_CUDA_EXPECT(Table::is_instance(values),
@@ -239,9 +249,75 @@ Napi::Value GroupBy::quantile(Napi::CallbackInfo const& info) {
   auto mr = MemoryResource::is_instance(info[3]) ? *MemoryResource::Unwrap(info[3].ToObject())
                                                  : rmm::mr::get_current_device_resource();
 
-  auto agg = cudf::make_quantile_aggregation(qs, interpolation);
+  if (!info[0].IsArray()) {
+    auto agg = cudf::make_quantile_aggregation(qs, interpolation);
+    return _single_aggregation(std::move(agg), values_table, mr, info);
+  }
 
-  return _single_aggregation(std::move(agg), values_table, mr, info);
+  std::vector<cudf::groupby::aggregation_request> requests;
+  for (cudf::size_type i = 0; i < values_table->num_columns(); ++i) {
+    auto request   = cudf::groupby::aggregation_request();
+    request.values = values_table->get_column(i).view();
+    request.aggregations.push_back(cudf::make_quantile_aggregation(qs, interpolation));
+    requests.emplace_back(std::move(request));
+  }
+
+  auto result     = groupby_->aggregate(requests, mr);
+  auto num_groups = result.first->num_rows();
+  auto num_qs     = static_cast<int32_t>(qs.size());
+
+  // libcudf returns the quantiles of every group as one flat column of `num_groups * num_qs`
+  // rows, with the quantiles of each group contiguous. Wrap each in a LIST column with one list
+  // of `num_qs` values per group.
+  auto result_cols = Napi::Array::New(info.Env(), result.second.size());
+  for (size_t i = 0; i < result.second.size(); ++i) {
+    auto offsets = cudf::sequence(num_groups + 1,
+                                  cudf::numeric_scalar<int32_t>(0),
+                                  cudf::numeric_scalar<int32_t>(num_qs),
+                                  mr);
+    auto lists   = cudf::make_lists_column(
+      num_groups, std::move(offsets), std::move(result.second[i].results[0]), 0, {});
+    result_cols.Set(i, Column::New(std::move(lists))->Value());
+  }
+
+  auto obj = Napi::Object::New(info.Env());
+  obj.Set("keys", Table::New(std::move(result.first)));
+  obj.Set("cols", result_cols);
+
+  return obj;
+}
+
+Napi::Value GroupBy::rolling(Napi::CallbackInfo const& info) {
+  CallbackArgs args{info};
+
+  std::unique_ptr<cudf::aggregation> agg = args[0];
+  cudf::size_type preceding              = args[1];
+  cudf::size_type following              = args[2];
+  cudf::size_type min_periods            = args[3];
+
+  auto values = args[4];
+  NODE_CUDA_EXPECT(Table::is_instance(values), "GroupBy rolling expects to have a 'values' table");
+  nv::Table* values_table = Table::Unwrap(values.ToObject());
+
+  rmm::mr::device_memory_resource* mr = args[5];
+
+  // grouped_rolling_window expects rows of the same group to be contiguous, so sort the keys
+  // and values into their groups first.
+  auto groups = groupby_->get_groups(*values_table, mr);
+  auto keys   = groups.keys->view();
+
+  auto result_cols = Napi::Array::New(info.Env(), groups.values->num_columns());
+  for (cudf::size_type i = 0; i < groups.values->num_columns(); ++i) {
+    auto col = cudf::grouped_rolling_window(
+      keys, groups.values->get_column(i), preceding, following, min_periods, agg, mr);
+    result_cols.Set(i, Column::New(std::move(col))->Value());
+  }
+
+  auto obj = Napi::Object::New(info.Env());
+  obj.Set("keys", Table::New(std::move(groups.keys)));
+  obj.Set("cols", result_cols);
+
+  return obj;
 }
 
 std::pair<nv::Table*, rmm::mr::device_memory_resource*> GroupBy::_get_basic_args(
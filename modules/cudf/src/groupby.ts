@@ -17,10 +17,10 @@ import {MemoryResource} from '@nvidia/rmm';
 import CUDF from './addon';
 import {Column} from './column';
 import {DataFrame, SeriesMap} from './data_frame';
-import {Series} from './series';
+import {RollingOptions, Series} from './series';
 import {Table} from './table';
 import {NullOrder} from './types/enums'
-import {Interpolation, TypeMap} from './types/mappings'
+import {Interpolation, RollingAggregation, TypeMap} from './types/mappings'
 
 /*
  * @param keys DataFrame whose rows act as the groupby keys
@@ -79,8 +79,17 @@ interface CudfGroupBy {
   _std(values: Table, memoryResource?: MemoryResource): {keys: Table, cols: Column[]};
   _sum(values: Table, memoryResource?: MemoryResource): {keys: Table, cols: Column[]};
   _var(values: Table, memoryResource?: MemoryResource): {keys: Table, cols: Column[]};
-  _quantile(q: number, values: Table, interpolation?: number, memoryResource?: MemoryResource):
-    {keys: Table, cols: [Column]};
+  _quantile(q: number|number[],
+            values: Table,
+            interpolation?: number,
+            memoryResource?: MemoryResource): {keys: Table, cols: [Column]};
+
+  _rolling(agg: RollingAggregation,
+           preceding: number,
+           following: number,
+           minPeriods: number,
+           values: Table,
+           memoryResource?: MemoryResource): {keys: Table, cols: Column[]};
 }
 
 export class GroupBy<T extends TypeMap, R extends keyof T> extends(
@@ -270,16 +279,54 @@ export class GroupBy<T extends TypeMap, R extends keyof T> extends(
   /**
    * Return values at the given quantile.
    *
-   * @param q the quantile to compute, 0 <= q <= 1
+   * @param q the quantile(s) to compute, 0 <= q <= 1. When `q` is an array, each group is sorted
+   *  once and the result values are lists with one element per quantile.
    * @param interpolation This optional parameter specifies the interpolation method to use,
    *  when the desired quantile lies between two data points i and j.
    * @param memoryResource The optional MemoryResource used to allocate the result's
    *   device memory.
    */
-  quantile(q                                         = 0.5,
+  quantile(q: number|number[]                        = 0.5,
            interpolation: keyof typeof Interpolation = 'linear',
            memoryResource?: MemoryResource) {
     return this.prepare_results(
       this._quantile(q, this._values.asTable(), Interpolation[interpolation], memoryResource));
   }
+
+  /**
+   * Compute an aggregation over a rolling window of `window` rows within each group. Windows do
+   * not cross group boundaries.
+   *
+   * The result has one row per input row, with the rows of each group made contiguous.
+   *
+   * @param agg The aggregation to compute over each window.
+   * @param window The number of rows in each window.
+   * @param options Options for the minimum number of observations, window centering, and memory
+   *   resource.
+   */
+  rolling(agg: RollingAggregation, window: number, options: RollingOptions = {}) {
+    const {minPeriods = window, center = false, memoryResource} = options;
+    const following = center ? Math.floor((window - 1) / 2) : 0;
+    return this.prepare_results(this._rolling(
+      agg, window - following, following, minPeriods, this._values.asTable(), memoryResource));
+  }
+
+  /**
+   * Compute an aggregation over expanding windows within each group, where the window of each
+   * row spans every row from the start of its group up to and including the row.
+   *
+   * The result has one row per input row, with the rows of each group made contiguous.
+   *
+   * @param agg The aggregation to compute over each window.
+   * @param options Options for the minimum number of observations (default 1) and memory
+   *   resource.
+   */
+  expanding(agg: RollingAggregation, options: Omit<RollingOptions, 'center'> = {}) {
+    const {minPeriods = 1, memoryResource} = options;
+    const values                           = this._values.asTable();
+    // Grouped windows are clamped to their group, so a window as long as the whole table always
+    // reaches back to the first row of the group
+    return this.prepare_results(this._rolling(
+      agg, Math.max(values.numRows, 1), 0, minPeriods, values, memoryResource));
+  }
 }
@@ -0,0 +1,136 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <node_cudf/column.hpp>
+#include <node_cudf/hash_join.hpp>
+#include <node_cudf/table.hpp>
+#include <node_cudf/utilities/error.hpp>
+#include <node_cudf/utilities/gather_maps.hpp>
+#include <node_cudf/utilities/napi_to_cpp.hpp>
+#include <node_cudf/utilities/stream.hpp>
+
+#include <node_rmm/utilities/napi_to_cpp.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/join.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <napi.h>
+
+namespace nv {
+
+//
+// Public API
+//
+
+Napi::FunctionReference HashJoinIndex::constructor;
+
+Napi::Object HashJoinIndex::Init(Napi::Env env, Napi::Object exports) {
+  Napi::Function ctor = DefineClass(env,
+                                    "HashJoinIndex",
+                                    {
+                                      InstanceAccessor<&HashJoinIndex::build>("build"),
+                                      InstanceAccessor<&HashJoinIndex::null_equality>(
+                                        "nullEquality"),
+                                      InstanceMethod<&HashJoinIndex::inner_join>("innerJoin"),
+                                      InstanceMethod<&HashJoinIndex::left_join>("leftJoin"),
+                                      InstanceMethod<&HashJoinIndex::full_join>("fullJoin"),
+                                    });
+
+  HashJoinIndex::constructor = Napi::Persistent(ctor);
+  HashJoinIndex::constructor.SuppressDestruct();
+  exports.Set("HashJoinIndex", ctor);
+
+  return exports;
+}
+
+ObjectUnwrap<HashJoinIndex> HashJoinIndex::New(Table const& build,
+                                               cudf::null_equality compare_nulls) {
+  auto env = constructor.Env();
+  return constructor.New(
+    {build.Value(), Napi::Boolean::New(env, compare_nulls == cudf::null_equality::EQUAL)});
+}
+
+HashJoinIndex::HashJoinIndex(CallbackArgs const& args) : Napi::ObjectWrap<HashJoinIndex>(args) {
+  auto env = args.Env();
+
+  NODE_CUDF_EXPECT(args.IsConstructCall(), "HashJoinIndex constructor requires 'new'", env);
+  NODE_CUDF_EXPECT(
+    Table::is_instance(args[0]), "HashJoinIndex constructor expects a build Table", env);
+
+  compare_nulls_ = args.Length() > 1 && !args[1].IsUndefined()
+                     ? args[1].operator cudf::null_equality()
+                     : cudf::null_equality::EQUAL;
+
+  build_        = Napi::Persistent(args[0].ToObject());
+  build_shares_ = Table::Unwrap(build_.Value())->share();
+  join_.reset(new cudf::hash_join(*Table::Unwrap(build_.Value()), compare_nulls_));
+}
+
+void HashJoinIndex::Finalize(Napi::Env env) {
+  join_.reset(nullptr);
+  build_shares_.clear();
+  build_.Reset();
+}
+
+std::pair<ObjectUnwrap<Column>, ObjectUnwrap<Column>> HashJoinIndex::inner_join(
+  Table const& probe, rmm::mr::device_memory_resource* mr) const {
+  return gather_maps_to_columns(
+    join_->inner_join(probe, compare_nulls_, get_current_stream(), mr));
+}
+
+std::pair<ObjectUnwrap<Column>, ObjectUnwrap<Column>> HashJoinIndex::left_join(
+  Table const& probe, rmm::mr::device_memory_resource* mr) const {
+  return gather_maps_to_columns(
+    join_->left_join(probe, compare_nulls_, get_current_stream(), mr));
+}
+
+std::pair<ObjectUnwrap<Column>, ObjectUnwrap<Column>> HashJoinIndex::full_join(
+  Table const& probe, rmm::mr::device_memory_resource* mr) const {
+  return gather_maps_to_columns(
+    join_->full_join(probe, compare_nulls_, get_current_stream(), mr));
+}
+
+//
+// Private API
+//
+
+Napi::Value HashJoinIndex::build(Napi::CallbackInfo const& info) { return build_.Value(); }
+
+Napi::Value HashJoinIndex::null_equality(Napi::CallbackInfo const& info) {
+  return Napi::Boolean::New(info.Env(), compare_nulls_ == cudf::null_equality::EQUAL);
+}
+
+Napi::Value HashJoinIndex::inner_join(Napi::CallbackInfo const& info) {
+  CallbackArgs args{info};
+  NODE_CUDF_EXPECT(Table::is_instance(args[0]), "innerJoin expects a probe Table", info.Env());
+  return gather_maps_to_array(info.Env(), inner_join(*Table::Unwrap(args[0].ToObject()), args[1]));
+}
+
+Napi::Value HashJoinIndex::left_join(Napi::CallbackInfo const& info) {
+  CallbackArgs args{info};
+  NODE_CUDF_EXPECT(Table::is_instance(args[0]), "leftJoin expects a probe Table", info.Env());
+  return gather_maps_to_array(info.Env(), left_join(*Table::Unwrap(args[0].ToObject()), args[1]));
+}
+
+Napi::Value HashJoinIndex::full_join(Napi::CallbackInfo const& info) {
+  CallbackArgs args{info};
+  NODE_CUDF_EXPECT(Table::is_instance(args[0]), "fullJoin expects a probe Table", info.Env());
+  return gather_maps_to_array(info.Env(), full_join(*Table::Unwrap(args[0].ToObject()), args[1]));
+}
+
+}  // namespace nv
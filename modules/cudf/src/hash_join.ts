@@ -0,0 +1,83 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import {MemoryResource} from '@nvidia/rmm';
+
+import CUDF from './addon';
+import {Column} from './column';
+import {Table} from './table';
+import {Int32} from './types/dtypes';
+
+interface HashJoinIndexConstructor {
+  readonly prototype: HashJoinIndex;
+  /**
+   * Build a hash table on the rows of a Table of join keys. The index can be probed by any number
+   * of Tables with the same key types, avoiding rebuilding the hash table for each join.
+   *
+   * @param build The Table of join keys to build the hash table from.
+   * @param nullEquality Whether null keys are considered equal (default true).
+   */
+  new(build: Table, nullEquality?: boolean): HashJoinIndex;
+}
+
+/**
+ * A low-level wrapper for a libcudf hash_join object, a reusable hash table built on the "build"
+ * (right-hand) side of a join.
+ */
+export interface HashJoinIndex {
+  /**
+   * The Table of join keys the hash table was built from.
+   */
+  readonly build: Table;
+
+  /**
+   * Whether null keys are considered equal by the hash table.
+   */
+  readonly nullEquality: boolean;
+
+  /**
+   * Compute the row indices of the inner join of a probe Table with the build Table.
+   *
+   * @param probe The Table of join keys to probe the hash table with.
+   * @param memoryResource The optional MemoryResource used to allocate the result Columns' device
+   *   memory.
+   * @returns A pair of [probe, build] gather maps.
+   */
+  innerJoin(probe: Table, memoryResource?: MemoryResource): [Column<Int32>, Column<Int32>];
+
+  /**
+   * Compute the row indices of the left join of a probe Table with the build Table. Probe rows
+   * without a match have an out-of-bounds build row index.
+   *
+   * @param probe The Table of join keys to probe the hash table with.
+   * @param memoryResource The optional MemoryResource used to allocate the result Columns' device
+   *   memory.
+   * @returns A pair of [probe, build] gather maps.
+   */
+  leftJoin(probe: Table, memoryResource?: MemoryResource): [Column<Int32>, Column<Int32>];
+
+  /**
+   * Compute the row indices of the full join of a probe Table with the build Table. Rows without
+   * a match have an out-of-bounds row index on the other side.
+   *
+   * @param probe The Table of join keys to probe the hash table with.
+   * @param memoryResource The optional MemoryResource used to allocate the result Columns' device
+   *   memory.
+   * @returns A pair of [probe, build] gather maps.
+   */
+  fullJoin(probe: Table, memoryResource?: MemoryResource): [Column<Int32>, Column<Int32>];
+}
+
+// eslint-disable-next-line @typescript-eslint/no-redeclare
+export const HashJoinIndex: HashJoinIndexConstructor = CUDF.HashJoinIndex;
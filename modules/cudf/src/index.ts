@@ -13,11 +13,18 @@
 // limitations under the License.
 
 export * from './column';
+export * from './csv_schema_cache';
 export * from './data_frame';
+export * from './data_frame_scan';
 export * from './groupby';
+export * from './hash_join';
 export * from './series';
+export * from './spill';
+export * from './stream';
 export * from './table';
+export * from './table_builder';
 export * from './types/csv';
 export * from './types/enums';
 export * from './types/dtypes';
 export * from './types/mappings';
+export * from './types/parquet';
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <node_cudf/scalar.hpp>
+#include <node_cudf/spill_manager.hpp>
 #include <node_cudf/utilities/dtypes.hpp>
 
 #include <node_rmm/device_buffer.hpp>
@@ -31,6 +32,9 @@
 #include <cudf/unary.hpp>
 #include <rmm/device_buffer.hpp>
 
+#include <array>
+#include <vector>
+
 namespace nv {
 
 /**
@@ -55,6 +59,13 @@ class Column : public Napi::ObjectWrap<Column> {
    */
   static ObjectUnwrap<Column> New(std::unique_ptr<cudf::column> column);
 
+  /**
+   * @brief Construct a new Column instance from existing device memory.
+   *
+   * @param props The Column constructor properties, e.g. `type`, `data`, `length` and `nullMask`.
+   */
+  static ObjectUnwrap<Column> New(Napi::Object const& props);
+
   /**
    * @brief Check whether an Napi value is an instance of `Column`.
    *
@@ -98,12 +109,18 @@ class Column : public Napi::ObjectWrap<Column> {
   /**
    * @brief Return a const reference to the data buffer
    */
-  inline DeviceBuffer const& data() const { return *DeviceBuffer::Unwrap(data_.Value()); }
+  inline DeviceBuffer const& data() const {
+    unspill();
+    return *DeviceBuffer::Unwrap(data_.Value());
+  }
 
   /**
    * @brief Return a const reference to the null bitmask buffer
    */
-  inline DeviceBuffer const& null_mask() const { return *DeviceBuffer::Unwrap(null_mask_.Value()); }
+  inline DeviceBuffer const& null_mask() const {
+    unspill();
+    return *DeviceBuffer::Unwrap(null_mask_.Value());
+  }
 
   /**
    * @brief Sets the column's null value indicator bitmask to `new_null_mask`.
@@ -223,12 +240,27 @@ class Column : public Napi::ObjectWrap<Column> {
 
   operator Napi::Value() const;
 
+  /**
+   * @brief Discard the cached statistics (min, max, sortedness, and distinct counts) about this
+   * Column's elements. Called whenever the elements or validity of the Column may have changed.
+   *
+   * Only this Column's own mutators (mutable_view(), set_null_mask(), etc.) call it. Writes to
+   * the underlying DeviceBuffer, or through another Column that shares it (e.g. a zero-copy
+   * slice or a DeviceBuffer view), aren't seen, so they leave stale statistics behind.
+   */
+  void invalidate_stats() const;
+
   // column/reductions.cpp
 
   /**
-   * @copydoc cudf::minmax(cudf::column_view const& col, rmm::mr::device_memory_resource* mr)
-   *
-   * @return std::pair<Scalar, Scalar>
+   * @brief Return whether this Column's elements are sorted in ascending order with nulls first.
+   * The result is cached until the Column is mutated.
+   */
+  bool is_sorted() const;
+
+  /**
+   * @brief Compute the min and max of this Column's elements. The result Scalars are cached and
+   * shared by later calls until the Column is mutated, so callers must not modify them.
    */
   std::pair<ObjectUnwrap<Scalar>, ObjectUnwrap<Scalar>> minmax(
     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
@@ -336,6 +368,19 @@ class Column : public Napi::ObjectWrap<Column> {
     cudf::interpolation i               = cudf::interpolation::LINEAR,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
 
+  /**
+   * @brief Compute multiple quantiles of this Column's non-null elements with a single sort.
+   *
+   * @param q The quantiles to compute, 0 <= q <= 1
+   * @param i The interpolation used when a quantile lies between two elements
+   * @param mr Device memory resource used to allocate the returned column's device memory.
+   * @return A FLOAT64 Column with one element per quantile
+   */
+  ObjectUnwrap<Column> quantiles(
+    std::vector<double> const& q,
+    cudf::interpolation i               = cudf::interpolation::LINEAR,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
   // column/binaryop.cpp
 
   // cudf::binary_operator::ADD
@@ -596,6 +641,97 @@ class Column : public Napi::ObjectWrap<Column> {
   ObjectUnwrap<Column> drop_nans(
     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
 
+  // column/rolling.cpp
+  ObjectUnwrap<Column> rolling_window(
+    cudf::size_type preceding_window,
+    cudf::size_type following_window,
+    cudf::size_type min_periods,
+    std::unique_ptr<cudf::aggregation> const& agg,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  ObjectUnwrap<Column> rolling_window(
+    Column const& preceding_window,
+    Column const& following_window,
+    cudf::size_type min_periods,
+    std::unique_ptr<cudf::aggregation> const& agg,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Compute a rolling aggregation over windows defined by a range of values in an
+   * ascending-sorted, non-null `orderby` column. The window for row `i` includes every row `j`
+   * where `orderby[i] - preceding <= orderby[j] <= orderby[i] + following`.
+   *
+   * @param orderby The column that defines the window bounds.
+   * @param preceding The range before each row (a duration for timestamp columns).
+   * @param following The range after each row (a duration for timestamp columns).
+   * @param min_periods Minimum number of observations in a window to produce a non-null value.
+   * @param agg The rolling aggregation to perform.
+   * @param mr Device memory resource used to allocate the returned column's device memory.
+   */
+  ObjectUnwrap<Column> range_rolling_window(
+    Column const& orderby,
+    Scalar const& preceding,
+    Scalar const& following,
+    cudf::size_type min_periods,
+    std::unique_ptr<cudf::aggregation> const& agg,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  // column/spilling.cpp
+
+  /**
+   * @brief Returns whether the SpillManager may spill this column's device memory.
+   */
+  inline bool spillable() const noexcept { return spillable_; }
+
+  /**
+   * @brief Allow or prevent the SpillManager from spilling this column and its children.
+   *
+   * Columns whose DeviceBuffers are shared (see `is_shared()`) stay in device memory while they're
+   * shared, even if marked spillable.
+   */
+  void set_spillable(bool spillable);
+
+  /**
+   * @brief Returns whether this column's data or null mask are shared with another Column (e.g. a
+   * slice), a DeviceBuffer view, or an object that holds a share of them (e.g. a GroupBy or
+   * HashJoinIndex). Spilling a shared buffer would free memory its other users still read.
+   */
+  bool is_shared() const;
+
+  /**
+   * @brief Take shares of the data and null masks of this column and its children, so they aren't
+   * spilled while the returned shares are alive.
+   */
+  std::vector<DeviceBuffer::Share> share() const;
+
+  /**
+   * @brief Returns whether this column's data or null mask are spilled out of device memory.
+   */
+  inline bool is_spilled() const noexcept {
+    return spilled_data_ != nullptr || spilled_mask_ != nullptr;
+  }
+
+  /**
+   * @brief Returns the number of bytes of device memory held by this column's data and null mask,
+   * or 0 if they're shared, since spilling them wouldn't free anything.
+   */
+  std::size_t device_bytes() const;
+
+  /**
+   * @brief Copy this column's data and null mask to host memory (or disk) and release their device
+   * memory.
+   *
+   * @return The number of bytes of device memory released, or 0 if they're shared.
+   */
+  std::size_t spill() const;
+
+  /**
+   * @brief Copy this column's spilled data and null mask back into device memory.
+   */
+  inline void unspill() const {
+    if (is_spilled()) { unspill_buffers(); }
+  }
+
   // column/transform.cpp
   std::pair<std::unique_ptr<rmm::device_buffer>, cudf::size_type> nans_to_nulls(
     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
@@ -606,6 +742,46 @@ class Column : public Napi::ObjectWrap<Column> {
     cudf::out_of_bounds_policy bounds_policy = cudf::out_of_bounds_policy::DONT_CHECK,
     rmm::mr::device_memory_resource* mr      = rmm::mr::get_current_device_resource()) const;
 
+  /**
+   * @brief Returns a zero-copy Column of the rows in [begin, end) that shares this Column's
+   * device memory and children.
+   *
+   * @param begin The index of the first row.
+   * @param end The index one past the last row.
+   */
+  ObjectUnwrap<Column> slice(cudf::size_type begin, cudf::size_type end) const;
+
+  // column/dictionary.cpp
+  /**
+   * @brief Dictionary-encode this Column into sorted, unique keys and unsigned integer indices.
+   *
+   * @param indices_type The unsigned integer type of the indices.
+   */
+  ObjectUnwrap<Column> encode_dictionary(
+    cudf::data_type indices_type        = cudf::data_type{cudf::type_id::UINT32},
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Decode this dictionary Column into a Column of its keys' type.
+   */
+  ObjectUnwrap<Column> decode_dictionary(
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Construct a dictionary Column from arbitrarily ordered unique keys and the indices of
+   * each row's key, e.g. from an Arrow dictionary Vector.
+   *
+   * libcudf requires sorted keys, so unsorted keys are sorted and the indices remapped. The
+   * result's null mask is copied from `indices`.
+   *
+   * @param keys The unique dictionary keys.
+   * @param indices The integer index of each row's key.
+   */
+  static ObjectUnwrap<Column> make_dictionary(
+    Column const& keys,
+    Column const& indices,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
   // column/unaryop.cpp
   ObjectUnwrap<Column> cast(
     cudf::data_type out_type,
@@ -638,8 +814,20 @@ class Column : public Napi::ObjectWrap<Column> {
   Napi::Reference<Napi::Object> null_mask_{};  ///< Bitmask used to represent null values.
                                                ///< May be empty if `null_count() == 0`
   mutable cudf::size_type null_count_{cudf::UNKNOWN_NULL_COUNT};  ///< The number of null elements
+  mutable Napi::Reference<Napi::Object> min_{};  ///< Cached min Scalar, empty if unknown
+  mutable Napi::Reference<Napi::Object> max_{};  ///< Cached max Scalar, empty if unknown
+  mutable int8_t is_sorted_{-1};                 ///< Cached sortedness, -1 if unknown
+  mutable std::array<cudf::size_type, 2> distinct_count_{-1, -1};  ///< Cached nunique counts,
+                                                                   ///< indexed by `dropna`
   Napi::Reference<Napi::Array> children_{};  ///< Depending on element type, child
                                              ///< columns may contain additional data
+  bool spillable_{false};                    ///< Whether the SpillManager may spill this column
+  mutable std::unique_ptr<SpilledBuffer> spilled_data_{};  ///< Spilled data, if any
+  mutable std::unique_ptr<SpilledBuffer> spilled_mask_{};  ///< Spilled null mask, if any
+  DeviceBuffer::Share data_share_{};                       ///< This column's share of data_
+  DeviceBuffer::Share mask_share_{};                       ///< This column's share of null_mask_
+
+  void unspill_buffers() const;
 
   Napi::Value type(Napi::CallbackInfo const& info);
   void type(Napi::CallbackInfo const& info, Napi::Value const& value);
@@ -655,6 +843,11 @@ class Column : public Napi::ObjectWrap<Column> {
 
   Napi::Value gather(Napi::CallbackInfo const& info);
 
+  // column/dictionary.cpp
+  Napi::Value encode_dictionary(Napi::CallbackInfo const& info);
+  Napi::Value decode_dictionary(Napi::CallbackInfo const& info);
+  static Napi::Value make_dictionary(Napi::CallbackInfo const& info);
+
   Napi::Value get_child(Napi::CallbackInfo const& info);
   // Napi::Value set_child(Napi::CallbackInfo const& info);
 
@@ -698,10 +891,22 @@ class Column : public Napi::ObjectWrap<Column> {
   Napi::Value drop_nulls(Napi::CallbackInfo const& info);
   Napi::Value drop_nans(Napi::CallbackInfo const& info);
 
+  // column/rolling.cpp
+  Napi::Value rolling_window(Napi::CallbackInfo const& info);
+  Napi::Value range_rolling_window(Napi::CallbackInfo const& info);
+
+  // column/spilling.cpp
+  Napi::Value spillable(Napi::CallbackInfo const& info);
+  void spillable(Napi::CallbackInfo const& info, Napi::Value const& value);
+  Napi::Value spilled(Napi::CallbackInfo const& info);
+  Napi::Value spill(Napi::CallbackInfo const& info);
+
   // column/transform.cpp
   Napi::Value nans_to_nulls(Napi::CallbackInfo const& info);
 
   // column/reductions.cpp
+  Napi::Value stats(Napi::CallbackInfo const& info);
+  Napi::Value describe(Napi::CallbackInfo const& info);
   Napi::Value min(Napi::CallbackInfo const& info);
   Napi::Value max(Napi::CallbackInfo const& info);
   Napi::Value minmax(Napi::CallbackInfo const& info);
@@ -716,6 +921,7 @@ class Column : public Napi::ObjectWrap<Column> {
   Napi::Value variance(Napi::CallbackInfo const& info);
   Napi::Value std(Napi::CallbackInfo const& info);
   Napi::Value quantile(Napi::CallbackInfo const& info);
+  Napi::Value quantiles(Napi::CallbackInfo const& info);
 
   // column/unaryop.cpp
   Napi::Value cast(Napi::CallbackInfo const& info);
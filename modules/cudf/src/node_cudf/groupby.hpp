@@ -20,6 +20,7 @@
 #include <node_cudf/table.hpp>
 
 #include <napi.h>
+#include <vector>
 
 namespace nv {
 
@@ -62,6 +63,7 @@ class GroupBy : public Napi::ObjectWrap<GroupBy> {
   static Napi::FunctionReference constructor;
 
   std::unique_ptr<cudf::groupby::groupby> groupby_;
+  std::vector<DeviceBuffer::Share> keys_shares_{};  ///< Keeps the keys in device memory
 
   Napi::Value get_groups(Napi::CallbackInfo const& info);
 
@@ -79,6 +81,8 @@ class GroupBy : public Napi::ObjectWrap<GroupBy> {
   Napi::Value var(Napi::CallbackInfo const& info);
   Napi::Value quantile(Napi::CallbackInfo const& info);
 
+  Napi::Value rolling(Napi::CallbackInfo const& info);
+
   std::pair<nv::Table*, rmm::mr::device_memory_resource*> _get_basic_args(
     Napi::CallbackInfo const& info);
 
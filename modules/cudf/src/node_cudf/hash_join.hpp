@@ -0,0 +1,129 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <node_cudf/table.hpp>
+
+#include <nv_node/utilities/args.hpp>
+
+#include <cudf/join.hpp>
+#include <cudf/types.hpp>
+
+#include <napi.h>
+
+#include <memory>
+#include <vector>
+
+namespace nv {
+
+/**
+ * @brief An owning wrapper around a cudf::hash_join, a hash table built once on the rows of a
+ * "build" Table that can be probed by many "probe" Tables.
+ *
+ */
+class HashJoinIndex : public Napi::ObjectWrap<HashJoinIndex> {
+ public:
+  /**
+   * @brief Initialize and export the HashJoinIndex JavaScript constructor and prototype.
+   *
+   * @param env The active JavaScript environment.
+   * @param exports The exports object to decorate.
+   * @return Napi::Object The decorated exports object.
+   */
+  static Napi::Object Init(Napi::Env env, Napi::Object exports);
+
+  /**
+   * @brief Construct a new HashJoinIndex instance from C++.
+   *
+   * @param build The Table of join keys to build the hash table from.
+   * @param compare_nulls Whether null keys are considered equal.
+   */
+  static ObjectUnwrap<HashJoinIndex> New(
+    Table const& build, cudf::null_equality compare_nulls = cudf::null_equality::EQUAL);
+
+  /**
+   * @brief Check whether an Napi value is an instance of `HashJoinIndex`.
+   *
+   * @param val The Napi::Value to test
+   * @return true if the value is a `HashJoinIndex`
+   * @return false if the value is not a `HashJoinIndex`
+   */
+  inline static bool is_instance(Napi::Value const& val) {
+    return val.IsObject() and val.As<Napi::Object>().InstanceOf(constructor.Value());
+  }
+
+  /**
+   * @brief Construct a new HashJoinIndex instance from JavaScript.
+   *
+   */
+  HashJoinIndex(CallbackArgs const& args);
+
+  /**
+   * @brief Destructor called when the JavaScript VM garbage collects this HashJoinIndex
+   * instance.
+   *
+   * @param env The active JavaScript environment.
+   */
+  void Finalize(Napi::Env env) override;
+
+  /**
+   * @brief Compute the row indices of the inner join of a probe Table with the build Table.
+   *
+   * @param probe The Table of join keys to probe the hash table with.
+   * @param mr Device memory resource used to allocate the returned gather maps.
+   * @return A pair of gather maps of (probe, build) row indices.
+   */
+  std::pair<ObjectUnwrap<Column>, ObjectUnwrap<Column>> inner_join(
+    Table const& probe,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Compute the row indices of the left join of a probe Table with the build Table.
+   *
+   * @param probe The Table of join keys to probe the hash table with.
+   * @param mr Device memory resource used to allocate the returned gather maps.
+   * @return A pair of gather maps of (probe, build) row indices.
+   */
+  std::pair<ObjectUnwrap<Column>, ObjectUnwrap<Column>> left_join(
+    Table const& probe,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Compute the row indices of the full join of a probe Table with the build Table.
+   *
+   * @param probe The Table of join keys to probe the hash table with.
+   * @param mr Device memory resource used to allocate the returned gather maps.
+   * @return A pair of gather maps of (probe, build) row indices.
+   */
+  std::pair<ObjectUnwrap<Column>, ObjectUnwrap<Column>> full_join(
+    Table const& probe,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  static Napi::FunctionReference constructor;
+
+  Napi::ObjectReference build_;              ///< The build Table, kept alive for the hash table
+  std::vector<DeviceBuffer::Share> build_shares_{};  ///< Keeps the build Table in device memory
+  cudf::null_equality compare_nulls_{};      ///< Whether null keys are considered equal
+  std::unique_ptr<cudf::hash_join> join_{};  ///< The hash table built on the build Table
+
+  Napi::Value build(Napi::CallbackInfo const& info);
+  Napi::Value null_equality(Napi::CallbackInfo const& info);
+  Napi::Value inner_join(Napi::CallbackInfo const& info);
+  Napi::Value left_join(Napi::CallbackInfo const& info);
+  Napi::Value full_join(Napi::CallbackInfo const& info);
+};
+
+}  // namespace nv
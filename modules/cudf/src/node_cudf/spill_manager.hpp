@@ -0,0 +1,162 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <napi.h>
+#include <rmm/device_buffer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+
+namespace nv {
+
+class Column;
+
+/**
+ * @brief A copy of a device buffer's contents in pinned host memory, or in a file in the
+ * SpillManager's spill directory.
+ */
+class SpilledBuffer {
+ public:
+  /**
+   * @brief Copy the contents of a device buffer out of device memory.
+   *
+   * @param env The active JavaScript environment.
+   * @param buffer The device buffer to copy.
+   */
+  SpilledBuffer(Napi::Env const& env, rmm::device_buffer const& buffer);
+
+  ~SpilledBuffer();
+
+  SpilledBuffer(SpilledBuffer const&) = delete;
+  SpilledBuffer& operator=(SpilledBuffer const&) = delete;
+
+  inline std::size_t size() const noexcept { return size_; }
+
+  /**
+   * @brief Resize `buffer` to hold the spilled contents, and copy them into it.
+   *
+   * @param env The active JavaScript environment.
+   * @param buffer The device buffer to copy into.
+   */
+  void copy_to(Napi::Env const& env, rmm::device_buffer& buffer) const;
+
+ private:
+  std::size_t size_{};
+  void* host_{nullptr};  ///< Pinned host copy, or nullptr if spilled to `path_`
+  std::string path_{};   ///< Spill file path, or empty if spilled to `host_`
+};
+
+/**
+ * @brief Tracks spillable Columns in least-recently-used order, and spills the device memory of
+ * the coldest Columns to pinned host memory or to disk when the device memory held by spillable
+ * Columns exceeds a limit.
+ *
+ * Columns used during the current turn of the event loop are never spilled automatically, since
+ * libcudf may still hold views of them.
+ */
+class SpillManager {
+ public:
+  /**
+   * @brief Returns the process-wide SpillManager.
+   */
+  static SpillManager& get();
+
+  /**
+   * @brief Initialize and export the spill functions.
+   *
+   * @param env The active JavaScript environment.
+   * @param exports The exports object to decorate.
+   * @return Napi::Object The decorated exports object.
+   */
+  static Napi::Object Init(Napi::Env env, Napi::Object exports);
+
+  /**
+   * @brief Mark a spillable Column as the most recently used, then spill colder Columns if the
+   * device memory held by spillable Columns exceeds the device limit.
+   */
+  void touch(Column const& column);
+
+  /**
+   * @brief Stop tracking a Column, e.g. when it is no longer spillable or is garbage collected.
+   */
+  void untrack(Column const& column);
+
+  /**
+   * @brief Spill a Column's device memory, whether or not it is tracked.
+   *
+   * @return The number of bytes of device memory freed.
+   */
+  std::size_t spill_column(Column const& column);
+
+  /**
+   * @brief Spill the least-recently-used Columns not used during the current turn of the event
+   * loop, until at least `bytes` of device memory have been freed.
+   *
+   * @return The number of bytes of device memory freed.
+   */
+  std::size_t spill(std::size_t bytes);
+
+  inline std::string const& directory() const noexcept { return directory_; }
+
+  inline void record_spill(std::size_t bytes) noexcept {
+    ++spill_count_;
+    spilled_bytes_ += bytes;
+    host_bytes_ += bytes;
+  }
+
+  inline void record_unspill(std::size_t bytes) noexcept {
+    ++unspill_count_;
+    unspilled_bytes_ += bytes;
+  }
+
+  inline void release_host(std::size_t bytes) noexcept { host_bytes_ -= bytes; }
+
+ private:
+  SpillManager() = default;
+
+  struct entry {
+    std::list<Column const*>::iterator position;
+    std::uint64_t epoch;  ///< The epoch in which the Column was last touched
+    std::size_t bytes;    ///< Device bytes held by the Column when last touched, 0 if spilled
+  };
+
+  void advance_epoch_on_next_tick(Napi::Env const& env);
+
+  std::list<Column const*> lru_{};  ///< Tracked Columns, least recently used first
+  std::unordered_map<Column const*, entry> entries_{};
+
+  std::uint64_t epoch_{0};       ///< Incremented once per turn of the event loop with a touch
+  bool epoch_scheduled_{false};  ///< Whether the next epoch increment is already scheduled
+
+  std::size_t device_limit_{SIZE_MAX};  ///< Spill when tracked device bytes exceed this limit
+  std::string directory_{};             ///< Spill to files here, or to pinned memory if empty
+
+  std::size_t device_bytes_{0};  ///< Device bytes held by tracked Columns
+  std::size_t host_bytes_{0};    ///< Bytes currently spilled to host memory or disk
+  std::size_t spill_count_{0};
+  std::size_t unspill_count_{0};
+  std::size_t spilled_bytes_{0};
+  std::size_t unspilled_bytes_{0};
+
+  static Napi::Value set_spill_options(Napi::CallbackInfo const& info);
+  static Napi::Value get_spill_stats(Napi::CallbackInfo const& info);
+  static Napi::Value spill_device_memory(Napi::CallbackInfo const& info);
+};
+
+}  // namespace nv
@@ -26,6 +26,8 @@
 #include <cudf/types.hpp>
 
 #include <napi.h>
+#include <string>
+#include <vector>
 
 namespace nv {
 
@@ -158,6 +160,18 @@ class Table : public Napi::ObjectWrap<Table> {
     return *Column::Unwrap(columns_.Value().Get(i).ToObject());
   }
 
+  /**
+   * @brief Take shares of the device memory of every column in the table, so it isn't spilled
+   * while the returned shares are alive.
+   */
+  std::vector<DeviceBuffer::Share> share() const {
+    std::vector<DeviceBuffer::Share> shares{};
+    for (cudf::size_type i = 0; i < num_columns(); ++i) {
+      for (auto& share : get_column(i).share()) { shares.push_back(std::move(share)); }
+    }
+    return shares;
+  }
+
   ObjectUnwrap<Table> apply_boolean_mask(
     Column const& boolean_mask,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
@@ -172,11 +186,213 @@ class Table : public Napi::ObjectWrap<Table> {
     cudf::size_type threshold,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
 
+  /**
+   * @brief Remove duplicate rows, comparing rows by the key columns. The result is sorted by the
+   * key columns.
+   *
+   * @param keys The indices of the key columns.
+   * @param keep Which row of each set of duplicates to keep: the first, the last, or none.
+   * @param nulls_equal Whether null keys are considered equal.
+   * @param mr Device memory resource used to allocate the returned Table's device memory.
+   */
+  ObjectUnwrap<Table> drop_duplicates(
+    std::vector<cudf::size_type> const& keys,
+    cudf::duplicate_keep_option keep,
+    cudf::null_equality nulls_equal     = cudf::null_equality::EQUAL,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the exact number of distinct rows.
+   *
+   * @param nulls_equal Whether null elements are considered equal.
+   */
+  cudf::size_type distinct_count(
+    cudf::null_equality nulls_equal = cudf::null_equality::EQUAL) const;
+
   ObjectUnwrap<Table> gather(
     Column const& gather_map,
     cudf::out_of_bounds_policy bounds_policy = cudf::out_of_bounds_policy::DONT_CHECK,
     rmm::mr::device_memory_resource* mr      = rmm::mr::get_current_device_resource()) const;
 
+  /**
+   * @brief Returns zero-copy Tables of the row ranges [indices[0], indices[1]),
+   * [indices[2], indices[3]), ..., whose Columns share this Table's device memory.
+   *
+   * @param indices An even number of row indices, the begin and end of each range.
+   */
+  std::vector<ObjectUnwrap<Table>> slice(std::vector<cudf::size_type> const& indices) const;
+
+  /**
+   * @brief Returns zero-copy Tables of the rows between consecutive split points, i.e.
+   * [0, splits[0]), [splits[0], splits[1]), ..., [splits[n - 1], num_rows()).
+   *
+   * @param splits Ascending row indices to split at.
+   */
+  std::vector<ObjectUnwrap<Table>> split(std::vector<cudf::size_type> const& splits) const;
+
+  // table/partitioning.cpp
+
+  /**
+   * @brief Partition this Table's rows into `num_partitions` partitions by the hash of the key
+   * columns, in a single pass.
+   *
+   * @param keys The indices of the key columns to hash.
+   * @param num_partitions The number of partitions.
+   * @param mr Device memory resource used to allocate the returned Table's device memory.
+   * @return The Table of rows ordered by partition, and the row offset where each partition
+   * starts.
+   */
+  std::pair<ObjectUnwrap<Table>, std::vector<cudf::size_type>> hash_partition(
+    std::vector<cudf::size_type> const& keys,
+    cudf::size_type num_partitions,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  // table/sorting.cpp
+
+  /**
+   * @brief Sort this Table's rows by the rows of a Table of sort keys in a single pass.
+   *
+   * @param keys The Table of sort keys. Must have the same number of rows as this Table.
+   * @param column_order The desired sort order for each key column.
+   * @param null_precedence The desired order of nulls relative to other elements for each key
+   * column.
+   * @param mr Device memory resource used to allocate the returned Table's device memory.
+   * @return The sorted Table.
+   */
+  ObjectUnwrap<Table> sort_by_key(
+    Table const& keys,
+    std::vector<cudf::order> const& column_order,
+    std::vector<cudf::null_order> const& null_precedence,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Sort this Table's rows by the rows of a Table of sort keys, preserving the relative
+   * order of rows with equal keys.
+   *
+   * @param keys The Table of sort keys. Must have the same number of rows as this Table.
+   * @param column_order The desired sort order for each key column.
+   * @param null_precedence The desired order of nulls relative to other elements for each key
+   * column.
+   * @param mr Device memory resource used to allocate the returned Table's device memory.
+   * @return The sorted Table.
+   */
+  ObjectUnwrap<Table> stable_sort_by_key(
+    Table const& keys,
+    std::vector<cudf::order> const& column_order,
+    std::vector<cudf::null_order> const& null_precedence,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Return the first `k` of this Table's rows when stable-sorted by a Table of sort keys.
+   *
+   * Only the `k` selected rows are gathered, so the full Table is never materialized in sorted
+   * order.
+   *
+   * @param keys The Table of sort keys. Must have the same number of rows as this Table.
+   * @param k The number of rows to return.
+   * @param column_order The desired sort order for each key column.
+   * @param null_precedence The desired order of nulls relative to other elements for each key
+   * column.
+   * @param mr Device memory resource used to allocate the returned Table's device memory.
+   * @return A Table of at most `k` rows.
+   */
+  ObjectUnwrap<Table> top_k(
+    Table const& keys,
+    cudf::size_type k,
+    std::vector<cudf::order> const& column_order,
+    std::vector<cudf::null_order> const& null_precedence,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  // table/reduction.cpp
+
+  /**
+   * @brief Compute each of the named reductions, and each of the given quantiles, over every
+   * Column of this Table. Every reduction is launched before any result is read back, so the
+   * caller only waits on the device once when reading the returned Scalars.
+   *
+   * @param aggs The names of the reductions to compute.
+   * @param quantiles The quantiles to compute, 0 <= q <= 1.
+   * @param interpolation The interpolation used when a quantile lies between two elements.
+   * @param mr Device memory resource used to allocate the returned Scalars' device memory.
+   * @return One row of per-Column results for each reduction, followed by one row for each
+   * quantile.
+   */
+  std::vector<std::vector<ObjectUnwrap<Scalar>>> reduce_all(
+    std::vector<std::string> const& aggs,
+    std::vector<double> const& quantiles = {},
+    cudf::interpolation interpolation    = cudf::interpolation::LINEAR,
+    rmm::mr::device_memory_resource* mr  = rmm::mr::get_current_device_resource()) const;
+
+  // table/join.cpp
+
+  /**
+   * @brief Compute the row indices of the inner join of this Table's rows with the rows of
+   * another Table.
+   *
+   * @param right The right Table of join keys.
+   * @param compare_nulls Whether null keys are considered equal.
+   * @param mr Device memory resource used to allocate the returned gather maps.
+   * @return A pair of gather maps of (left, right) row indices for the matching rows.
+   */
+  std::pair<ObjectUnwrap<Column>, ObjectUnwrap<Column>> inner_join(
+    Table const& right,
+    cudf::null_equality compare_nulls   = cudf::null_equality::EQUAL,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Compute the row indices of the left join of this Table's rows with the rows of
+   * another Table. Left rows without a match have an out-of-bounds right row index.
+   *
+   * @param right The right Table of join keys.
+   * @param compare_nulls Whether null keys are considered equal.
+   * @param mr Device memory resource used to allocate the returned gather maps.
+   * @return A pair of gather maps of (left, right) row indices.
+   */
+  std::pair<ObjectUnwrap<Column>, ObjectUnwrap<Column>> left_join(
+    Table const& right,
+    cudf::null_equality compare_nulls   = cudf::null_equality::EQUAL,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Compute the row indices of the full join of this Table's rows with the rows of
+   * another Table. Rows without a match have an out-of-bounds row index on the other side.
+   *
+   * @param right The right Table of join keys.
+   * @param compare_nulls Whether null keys are considered equal.
+   * @param mr Device memory resource used to allocate the returned gather maps.
+   * @return A pair of gather maps of (left, right) row indices.
+   */
+  std::pair<ObjectUnwrap<Column>, ObjectUnwrap<Column>> full_join(
+    Table const& right,
+    cudf::null_equality compare_nulls   = cudf::null_equality::EQUAL,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Compute the indices of this Table's rows that have a match in another Table.
+   *
+   * @param right The right Table of join keys.
+   * @param compare_nulls Whether null keys are considered equal.
+   * @param mr Device memory resource used to allocate the returned gather map.
+   * @return A gather map of left row indices.
+   */
+  ObjectUnwrap<Column> left_semi_join(
+    Table const& right,
+    cudf::null_equality compare_nulls   = cudf::null_equality::EQUAL,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Compute the indices of this Table's rows that have no match in another Table.
+   *
+   * @param right The right Table of join keys.
+   * @param compare_nulls Whether null keys are considered equal.
+   * @param mr Device memory resource used to allocate the returned gather map.
+   * @return A gather map of left row indices.
+   */
+  ObjectUnwrap<Column> left_anti_join(
+    Table const& right,
+    cudf::null_equality compare_nulls   = cudf::null_equality::EQUAL,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
  private:
   static Napi::FunctionReference constructor;
 
@@ -191,12 +407,37 @@ class Table : public Napi::ObjectWrap<Table> {
   Napi::Value get_column(Napi::CallbackInfo const& info);
   Napi::Value drop_nulls(Napi::CallbackInfo const& info);
   Napi::Value drop_nans(Napi::CallbackInfo const& info);
+  Napi::Value drop_duplicates(Napi::CallbackInfo const& info);
+  Napi::Value distinct_count(Napi::CallbackInfo const& info);
+
+  // table/copying.cpp
+  Napi::Value slice(Napi::CallbackInfo const& info);
+  Napi::Value split(Napi::CallbackInfo const& info);
+
+  // table/partitioning.cpp
+  Napi::Value hash_partition(Napi::CallbackInfo const& info);
 
   static Napi::Value read_csv(Napi::CallbackInfo const& info);
+  static Napi::Value read_parquet(Napi::CallbackInfo const& info);
   Napi::Value write_csv(Napi::CallbackInfo const& info);
 
   Napi::Value to_arrow(Napi::CallbackInfo const& info);
   Napi::Value order_by(Napi::CallbackInfo const& info);
+
+  // table/sorting.cpp
+  Napi::Value sort_by_key(Napi::CallbackInfo const& info);
+  Napi::Value stable_sort_by_key(Napi::CallbackInfo const& info);
+  Napi::Value top_k(Napi::CallbackInfo const& info);
+
+  // table/reduction.cpp
+  Napi::Value reduce_all(Napi::CallbackInfo const& info);
+
+  // table/join.cpp
+  Napi::Value inner_join(Napi::CallbackInfo const& info);
+  Napi::Value left_join(Napi::CallbackInfo const& info);
+  Napi::Value full_join(Napi::CallbackInfo const& info);
+  Napi::Value left_semi_join(Napi::CallbackInfo const& info);
+  Napi::Value left_anti_join(Napi::CallbackInfo const& info);
 };
 
 }  // namespace nv
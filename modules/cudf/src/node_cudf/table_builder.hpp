@@ -0,0 +1,141 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <node_cudf/column.hpp>
+
+#include <node_rmm/memory_resource.hpp>
+
+#include <nv_node/utilities/args.hpp>
+
+#include <cudf/types.hpp>
+
+#include <napi.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace nv {
+
+/**
+ * @brief An append-only builder of fixed-width columns. Rows are appended into per-column device
+ * buffers whose capacity grows geometrically, so appending many small batches costs amortized
+ * O(rows appended) instead of re-concatenating the whole table for each batch.
+ *
+ * Snapshots are zero-copy: each snapshot Column shares the builder's device buffers and only
+ * views the rows committed when the snapshot was taken. Later appends only write past the
+ * committed rows, so existing snapshots are never modified.
+ */
+class TableBuilder : public Napi::ObjectWrap<TableBuilder> {
+ public:
+  /**
+   * @brief Initialize and export the TableBuilder JavaScript constructor and prototype.
+   *
+   * @param env The active JavaScript environment.
+   * @param exports The exports object to decorate.
+   * @return Napi::Object The decorated exports object.
+   */
+  static Napi::Object Init(Napi::Env env, Napi::Object exports);
+
+  /**
+   * @brief Check whether an Napi value is an instance of `TableBuilder`.
+   *
+   * @param val The Napi::Value to test
+   * @return true if the value is a `TableBuilder`
+   * @return false if the value is not a `TableBuilder`
+   */
+  inline static bool is_instance(Napi::Value const& val) {
+    return val.IsObject() and val.As<Napi::Object>().InstanceOf(constructor.Value());
+  }
+
+  /**
+   * @brief Construct a new TableBuilder instance from JavaScript.
+   *
+   */
+  TableBuilder(CallbackArgs const& args);
+
+  /**
+   * @brief Destructor called when the JavaScript VM garbage collects this TableBuilder
+   * instance.
+   *
+   * @param env The active JavaScript environment.
+   */
+  void Finalize(Napi::Env env) override;
+
+  /**
+   * @brief Returns the number of committed rows.
+   */
+  inline cudf::size_type num_rows() const noexcept { return num_rows_; }
+
+  /**
+   * @brief Returns the number of columns.
+   */
+  inline cudf::size_type num_columns() const noexcept { return types_.Value().Length(); }
+
+  /**
+   * @brief Returns the number of rows that can be committed without reallocating.
+   */
+  inline cudf::size_type capacity() const noexcept { return capacity_; }
+
+  /**
+   * @brief Grow each column's capacity to at least `num_rows` rows. Capacity grows to at least
+   * twice the previous capacity, so repeated appends reallocate O(log n) times.
+   *
+   * @param num_rows The number of rows to reserve space for.
+   */
+  void reserve(cudf::size_type num_rows);
+
+  /**
+   * @brief Append a batch of rows and commit them.
+   *
+   * @param columns One value per column: a Column of the builder's column type, or host or
+   * device memory holding densely packed elements of the column type.
+   * @return The number of committed rows after the append.
+   */
+  cudf::size_type append(Napi::Array const& columns);
+
+  /**
+   * @brief Returns a Table of Columns that share the builder's device memory and view the rows
+   * committed so far.
+   */
+  Napi::Object snapshot() const;
+
+ private:
+  static Napi::FunctionReference constructor;
+
+  cudf::size_type num_rows_{0};  ///< The number of committed rows
+  cudf::size_type capacity_{0};  ///< The number of rows allocated in each column
+  Napi::Reference<Napi::Array> types_{};  ///< The Arrow DataType of each column
+  Napi::Reference<Napi::Array> data_{};   ///< The data DeviceBuffer of each column
+  Napi::Reference<Napi::Array> masks_{};  ///< The null mask DeviceBuffer of each column, empty
+                                          ///< until a batch with nulls is appended
+  Napi::ObjectReference mr_{};            ///< The MemoryResource used to allocate the buffers
+  std::vector<DeviceBuffer::Share> shares_{};  ///< Keeps snapshots of the buffers from spilling
+
+  cudf::data_type type(cudf::size_type column_index) const;
+  DeviceBuffer& data(cudf::size_type column_index) const;
+  DeviceBuffer& mask(cudf::size_type column_index) const;
+
+  void append_mask(cudf::size_type column_index, cudf::column_view const& batch);
+
+  Napi::Value num_rows(Napi::CallbackInfo const& info);
+  Napi::Value num_columns(Napi::CallbackInfo const& info);
+  Napi::Value capacity(Napi::CallbackInfo const& info);
+  Napi::Value reserve(Napi::CallbackInfo const& info);
+  Napi::Value append(Napi::CallbackInfo const& info);
+  Napi::Value snapshot(Napi::CallbackInfo const& info);
+};
+
+}  // namespace nv
@@ -0,0 +1,62 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <node_cudf/column.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <napi.h>
+
+#include <memory>
+#include <utility>
+
+namespace nv {
+
+using gather_map_t = std::unique_ptr<rmm::device_uvector<cudf::size_type>>;
+
+/**
+ * @brief Wrap a join gather map in an INT32 Column without copying it.
+ */
+inline ObjectUnwrap<Column> gather_map_to_column(gather_map_t map) {
+  auto size = static_cast<cudf::size_type>(map->size());
+  return Column::New(std::make_unique<cudf::column>(
+    cudf::data_type{cudf::type_id::INT32}, size, map->release()));
+}
+
+/**
+ * @brief Wrap a pair of (left, right) join gather maps in INT32 Columns without copying them.
+ */
+inline std::pair<ObjectUnwrap<Column>, ObjectUnwrap<Column>> gather_maps_to_columns(
+  std::pair<gather_map_t, gather_map_t> maps) {
+  return {gather_map_to_column(std::move(maps.first)),
+          gather_map_to_column(std::move(maps.second))};
+}
+
+/**
+ * @brief Return a pair of gather map Columns to JavaScript as a two-element Array.
+ */
+inline Napi::Value gather_maps_to_array(
+  Napi::Env const& env, std::pair<ObjectUnwrap<Column>, ObjectUnwrap<Column>> maps) {
+  auto ary = Napi::Array::New(env, 2);
+  ary.Set(0u, maps.first.object());
+  ary.Set(1u, maps.second.object());
+  return ary;
+}
+
+}  // namespace nv
@@ -0,0 +1,40 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <nv_node/utilities/span.hpp>
+
+#include <cudf/io/datasource.hpp>
+#include <cudf/io/types.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+namespace nv {
+
+/**
+ * @brief Wrap host memory sources for a cudf reader without copying them.
+ */
+inline std::vector<cudf::io::host_buffer> get_host_buffers(std::vector<Span<char>> const& sources) {
+  std::vector<cudf::io::host_buffer> buffers;
+  buffers.reserve(sources.size());
+  std::transform(sources.begin(), sources.end(), std::back_inserter(buffers), [&](auto const& buf) {
+    return cudf::io::host_buffer{buf.data(), buf.size()};
+  });
+  return buffers;
+}
+
+}  // namespace nv
@@ -19,6 +19,8 @@
 
 #include <nv_node/utilities/napi_to_cpp.hpp>
 
+#include <cudf/aggregation.hpp>
+#include <cudf/stream_compaction.hpp>
 #include <cudf/types.hpp>
 
 #include <napi.h>
@@ -50,6 +52,25 @@ inline NapiToCPP::operator cudf::null_policy() const {
   NAPI_THROW(Napi::Error::New(Env()), "Expected value to be a boolean");
 }
 
+template <>
+inline NapiToCPP::operator cudf::null_equality() const {
+  if (IsBoolean()) {
+    return ToBoolean() ? cudf::null_equality::EQUAL : cudf::null_equality::UNEQUAL;
+  }
+  NAPI_THROW(Napi::Error::New(Env()), "Expected value to be a boolean");
+}
+
+template <>
+inline NapiToCPP::operator cudf::duplicate_keep_option() const {
+  if (IsString()) {
+    auto const keep = operator std::string();
+    if (keep == "first") { return cudf::duplicate_keep_option::KEEP_FIRST; }
+    if (keep == "last") { return cudf::duplicate_keep_option::KEEP_LAST; }
+    if (keep == "none") { return cudf::duplicate_keep_option::KEEP_NONE; }
+  }
+  NAPI_THROW(Napi::Error::New(Env(), "Expected value to be 'first', 'last' or 'none'"));
+}
+
 template <>
 inline NapiToCPP::operator cudf::null_order() const {
   if (IsNumber()) { return ToBoolean() ? cudf::null_order::BEFORE : cudf::null_order::AFTER; }
@@ -117,4 +138,21 @@ inline NapiToCPP::operator cudf::interpolation() const {
   return static_cast<cudf::interpolation>(operator int32_t());
 }
 
+template <>
+inline NapiToCPP::operator std::unique_ptr<cudf::aggregation>() const {
+  if (IsString()) {
+    auto const name = operator std::string();
+    if (name == "sum") { return cudf::make_sum_aggregation(); }
+    if (name == "min") { return cudf::make_min_aggregation(); }
+    if (name == "max") { return cudf::make_max_aggregation(); }
+    if (name == "mean") { return cudf::make_mean_aggregation(); }
+    if (name == "count") { return cudf::make_count_aggregation(cudf::null_policy::EXCLUDE); }
+    if (name == "count_all") { return cudf::make_count_aggregation(cudf::null_policy::INCLUDE); }
+    if (name == "argmin") { return cudf::make_argmin_aggregation(); }
+    if (name == "argmax") { return cudf::make_argmax_aggregation(); }
+    if (name == "row_number") { return cudf::make_row_number_aggregation(); }
+  }
+  NAPI_THROW(Napi::Error::New(Env(), "Expected value to be an aggregation name"));
+}
+
 }  // namespace nv
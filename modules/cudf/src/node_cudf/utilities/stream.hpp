@@ -0,0 +1,44 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <nv_node/utilities/args.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <napi.h>
+
+namespace nv {
+
+/**
+ * @brief Get the stream on which cudf operations are enqueued. Defaults to
+ * `rmm::cuda_stream_default`.
+ */
+rmm::cuda_stream_view get_current_stream();
+
+/**
+ * @brief Set the stream on which subsequent cudf operations are enqueued.
+ *
+ * @param stream The new current stream.
+ * @return The previous current stream.
+ */
+rmm::cuda_stream_view set_current_stream(rmm::cuda_stream_view stream);
+
+Napi::Value current_stream(CallbackArgs const& args);
+
+Napi::Value exchange_current_stream(CallbackArgs const& args);
+
+}  // namespace nv
@@ -23,6 +23,7 @@ import {Table, ToArrowMetadata} from './table';
 import {
   Bool8,
   DataType,
+  Dictionary,
   Float32,
   Float64,
   IndexType,
@@ -41,7 +42,18 @@ import {
 import {
   NullOrder,
 } from './types/enums';
-import {ArrowToCUDFType, arrowToCUDFType} from './types/mappings';
+import {ArrowToCUDFType, arrowToCUDFType, RollingAggregation} from './types/mappings';
+
+export type RollingOptions = {
+  /**
+   * The minimum number of non-null values in a window required to produce a non-null result.
+   * Defaults to the window size for fixed windows, and 1 for range windows.
+   */
+  minPeriods?: number;
+  /** Whether to center each window on its row instead of ending it there. Default: false */
+  center?: boolean;
+  memoryResource?: MemoryResource;
+};
 
 export type SeriesProps<T extends DataType = any> = {
   /*
@@ -124,7 +136,7 @@ export type Series<T extends arrow.DataType = any> = {
   [arrow.Type.FixedSizeBinary]: never,  // TODO
   [arrow.Type.FixedSizeList]: never,    // TODO
   [arrow.Type.Map]: never,              // TODO
-  [arrow.Type.Dictionary]: never,       // TODO
+  [arrow.Type.Dictionary]: DictionarySeries<(T extends Dictionary ? T['dictionary'] : any)>,
 }[T['TType']];
 
 /**
@@ -271,7 +283,110 @@ export class AbstractSeries<T extends DataType = any> {
    * @returns Sorted values
    */
   sortValues(ascending = true, null_order: NullOrder = NullOrder.BEFORE): Series<T> {
-    return this.gather(this.orderBy(ascending, null_order));
+    const table = new Table({columns: [this._col]});
+    return this.__construct(
+      table.sortByKey(table, [ascending], [null_order]).getColumnByIndex<T>(0));
+  }
+
+  /**
+   * Return the `k` largest values in this Series, in descending order. Nulls are sorted last.
+   *
+   * @param k The number of values to return. Default: 5
+   * @param memoryResource The optional MemoryResource used to allocate the result Series's device
+   *   memory.
+   *
+   * @returns A Series of at most `k` values
+   */
+  nlargest(k = 5, memoryResource?: MemoryResource): Series<T> {
+    const table = new Table({columns: [this._col]});
+    return this.__construct(
+      table.topK(table, k, [false], [NullOrder.BEFORE], memoryResource).getColumnByIndex<T>(0));
+  }
+
+  /**
+   * Return the `k` smallest values in this Series, in ascending order. Nulls are sorted last.
+   *
+   * @param k The number of values to return. Default: 5
+   * @param memoryResource The optional MemoryResource used to allocate the result Series's device
+   *   memory.
+   *
+   * @returns A Series of at most `k` values
+   */
+  nsmallest(k = 5, memoryResource?: MemoryResource): Series<T> {
+    const table = new Table({columns: [this._col]});
+    return this.__construct(
+      table.topK(table, k, [true], [NullOrder.AFTER], memoryResource).getColumnByIndex<T>(0));
+  }
+
+  /**
+   * Compute an aggregation over a rolling window of `window` rows.
+   *
+   * @param agg The aggregation to compute over each window.
+   * @param window The number of rows in each window.
+   * @param options Options for the minimum number of observations, window centering, and memory
+   *   resource.
+   *
+   * @example
+   * ```typescript
+   * import {Series} from '@nvidia/cudf';
+   * const a = Series.new([1, 2, 3, 4, 5]);
+   *
+   * a.rolling('sum', 2) // [null, 3, 5, 7, 9]
+   * a.rolling('mean', 3, {minPeriods: 1, center: true}) // [1.5, 2, 3, 4, 4.5]
+   * ```
+   */
+  rolling(agg: RollingAggregation, window: number, options: RollingOptions = {}): Series {
+    const {minPeriods = window, center = false, memoryResource} = options;
+    const following = center ? Math.floor((window - 1) / 2) : 0;
+    return Series.new(
+      this._col.rolling(agg, window - following, following, minPeriods, memoryResource));
+  }
+
+  /**
+   * Compute an aggregation over expanding windows, where the window of row `i` spans every row
+   * from the start of the Series up to and including row `i`.
+   *
+   * @param agg The aggregation to compute over each window.
+   * @param options Options for the minimum number of observations (default 1) and memory
+   *   resource.
+   *
+   * @example
+   * ```typescript
+   * import {Series} from '@nvidia/cudf';
+   * const a = Series.new([1, 2, 3, 4, 5]);
+   *
+   * a.expanding('sum') // [1, 3, 6, 10, 15]
+   * a.expanding('max', {minPeriods: 2}) // [null, 2, 3, 4, 5]
+   * ```
+   */
+  expanding(agg: RollingAggregation, options: Omit<RollingOptions, 'center'> = {}): Series {
+    const {minPeriods = 1, memoryResource} = options;
+    // rolling windows are clamped to the bounds of the Column, so a window as long as the
+    // Column always reaches back to the first row
+    return Series.new(
+      this._col.rolling(agg, Math.max(this.length, 1), 0, minPeriods, memoryResource));
+  }
+
+  /**
+   * Compute an aggregation over windows defined by a range of values in `orderBy`. The window of
+   * row `i` includes each row `j` where
+   * `orderBy[i] - preceding <= orderBy[j] <= orderBy[i] + following`.
+   *
+   * @param agg The aggregation to compute over each window.
+   * @param orderBy A Series sorted in ascending order without nulls, the same length as this
+   *   Series. Durations for timestamp Series are in the units of the timestamp.
+   * @param preceding The range of values before each row.
+   * @param following The range of values after each row. Default: 0
+   * @param options Options for the minimum number of observations and memory resource.
+   */
+  rollingRange(agg: RollingAggregation,
+               orderBy: Series,
+               preceding: number|bigint,
+               following: number|bigint = 0,
+               options: Omit<RollingOptions, 'center'> = {}): Series {
+    const {minPeriods = 1, memoryResource} = options;
+    return Series.new(this._col.rollingRange(
+      agg, orderBy._col, preceding, following, minPeriods, memoryResource));
   }
 
   /**
@@ -294,6 +409,17 @@ export class AbstractSeries<T extends DataType = any> {
    */
   isValid(memoryResource?: MemoryResource) { return Series.new(this._col.isValid(memoryResource)); }
 
+  /**
+   * Dictionary-encode this Series into a Series of sorted unique keys and the index of each row's
+   * key. Low-cardinality Series take much less device memory once encoded, and can be sorted,
+   * grouped, and compared on their keys.
+   *
+   * @param memoryResource Memory resource used to allocate the result Column's device memory.
+   */
+  encodeDictionary(memoryResource?: MemoryResource): Series<Dictionary<T>> {
+    return Series.new(this._col.encodeDictionary(undefined, memoryResource));
+  }
+
   /**
    * drop Null values from the series
    * @param memoryResource Memory resource used to allocate the result Column's device memory.
@@ -372,6 +498,7 @@ import {
 import {StringSeries} from './series/string';
 import {ListSeries} from './series/list';
 import {StructSeries} from './series/struct';
+import {DictionarySeries} from './series/dictionary';
 
 export {
   Bool8Series,
@@ -388,6 +515,7 @@ export {
   StringSeries,
   ListSeries,
   StructSeries,
+  DictionarySeries,
 };
 
 function asColumn<T extends DataType>(value: SeriesProps<T>|Column<T>|arrow.Vector<T>): Column<T> {
@@ -455,7 +583,7 @@ const columnToSeries = (() => {
     public visitStruct               <T extends Struct>(col: Column<T>) { return new (StructSeries as any)(col); }
     // public visitDenseUnion           <T extends DenseUnion>(col: Column<T>) { return new (DenseUnionSeries as any)(col); }
     // public visitSparseUnion          <T extends SparseUnion>(col: Column<T>) { return new (SparseUnionSeries as any)(col); }
-    // public visitDictionary           <T extends Dictionary>(col: Column<T>) { return new (DictionarySeries as any)(col); }
+    public visitDictionary           <T extends Dictionary>(col: Column<T>) { return new (DictionarySeries as any)(col); }
     // public visitIntervalDayTime      <T extends IntervalDayTime>(col: Column<T>) { return new (IntervalDayTimeSeries as any)(col); }
     // public visitIntervalYearMonth    <T extends IntervalYearMonth>(col: Column<T>) { return new (IntervalYearMonthSeries as any)(col); }
     // public visitFixedSizeList        <T extends FixedSizeList>(col: Column<T>) { return new (FixedSizeListSeries as any)(col); }
@@ -0,0 +1,186 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import {MemoryResource} from '@nvidia/rmm';
+
+import {Column} from '../column';
+import {Scalar} from '../scalar';
+import {Series} from '../series';
+import {Bool8, DataType, Dictionary, Uint32} from '../types/dtypes'
+
+export type DictionaryComparison = 'eq'|'ne'|'lt'|'le'|'gt'|'ge';
+
+/**
+ * A Series of dictionary-encoded (categorical) values.
+ *
+ * Each row stores the index of its value in a sorted Series of unique keys, so low-cardinality
+ * data takes much less device memory than the decoded values.
+ */
+export class DictionarySeries<T extends DataType> extends Series<Dictionary<T>> {
+  /**
+   * Casts the decoded values to a new dtype (similar to `static_cast` in C++).
+   *
+   * @param dataType The new dtype.
+   * @param memoryResource The optional MemoryResource used to allocate the result Series's device
+   *   memory.
+   * @returns Series of same size as the current Series containing result of the `cast` operation.
+   */
+  cast<R extends DataType>(dataType: R, memoryResource?: MemoryResource): Series<R> {
+    return (this.decode(memoryResource) as any).cast(dataType, memoryResource);
+  }
+
+  /**
+   * Series of the index of each row's key in `categories`
+   */
+  get codes() { return Series.new(this._codes()); }
+
+  /**
+   * Series of the sorted, unique keys
+   */
+  get categories(): Series<T> { return Series.new(this._col.getChild<T>(1)); }
+
+  /**
+   * Decode the dictionary into a Series of its keys' type.
+   *
+   * @param memoryResource The optional MemoryResource used to allocate the result Series's device
+   *   memory.
+   */
+  decode(memoryResource?: MemoryResource): Series<T> {
+    return Series.new(this._col.decodeDictionary(memoryResource) as Column<T>);
+  }
+
+  /**
+   * Perform the binary '==' operation between this Series and a key.
+   *
+   * @param rhs The key value or Scalar to compare against.
+   * @param memoryResource The optional MemoryResource used to allocate the result Series's device
+   *   memory.
+   * @returns A Series of booleans with the comparison result.
+   */
+  eq(rhs: T['scalarType']|Scalar<T>, memoryResource?: MemoryResource) {
+    return this._compare('eq', rhs, memoryResource);
+  }
+
+  /**
+   * Perform the binary '!=' operation between this Series and a key.
+   *
+   * @param rhs The key value or Scalar to compare against.
+   * @param memoryResource The optional MemoryResource used to allocate the result Series's device
+   *   memory.
+   * @returns A Series of booleans with the comparison result.
+   */
+  ne(rhs: T['scalarType']|Scalar<T>, memoryResource?: MemoryResource) {
+    return this._compare('ne', rhs, memoryResource);
+  }
+
+  /**
+   * Perform the binary '<' operation between this Series and a key.
+   *
+   * @param rhs The key value or Scalar to compare against.
+   * @param memoryResource The optional MemoryResource used to allocate the result Series's device
+   *   memory.
+   * @returns A Series of booleans with the comparison result.
+   */
+  lt(rhs: T['scalarType']|Scalar<T>, memoryResource?: MemoryResource) {
+    return this._compare('lt', rhs, memoryResource);
+  }
+
+  /**
+   * Perform the binary '<=' operation between this Series and a key.
+   *
+   * @param rhs The key value or Scalar to compare against.
+   * @param memoryResource The optional MemoryResource used to allocate the result Series's device
+   *   memory.
+   * @returns A Series of booleans with the comparison result.
+   */
+  le(rhs: T['scalarType']|Scalar<T>, memoryResource?: MemoryResource) {
+    return this._compare('le', rhs, memoryResource);
+  }
+
+  /**
+   * Perform the binary '>' operation between this Series and a key.
+   *
+   * @param rhs The key value or Scalar to compare against.
+   * @param memoryResource The optional MemoryResource used to allocate the result Series's device
+   *   memory.
+   * @returns A Series of booleans with the comparison result.
+   */
+  gt(rhs: T['scalarType']|Scalar<T>, memoryResource?: MemoryResource) {
+    return this._compare('gt', rhs, memoryResource);
+  }
+
+  /**
+   * Perform the binary '>=' operation between this Series and a key.
+   *
+   * @param rhs The key value or Scalar to compare against.
+   * @param memoryResource The optional MemoryResource used to allocate the result Series's device
+   *   memory.
+   * @returns A Series of booleans with the comparison result.
+   */
+  ge(rhs: T['scalarType']|Scalar<T>, memoryResource?: MemoryResource) {
+    return this._compare('ge', rhs, memoryResource);
+  }
+
+  /**
+   * Compare each key against `rhs` once, then gather the per-key results by each row's code. This
+   * touches only the keys and the codes, never the decoded values.
+   *
+   * @ignore
+   */
+  protected _compare(op: DictionaryComparison,
+                     rhs: T['scalarType']|Scalar<T>,
+                     memoryResource?: MemoryResource): Series<Bool8> {
+    const keys = this._col.getChild<T>(1) as any;
+    const value =
+      rhs instanceof Scalar ? rhs : new Scalar({type: this.type.dictionary, value: rhs});
+    const matches = keys[op](value, memoryResource) as Column<Bool8>;
+    // The code under a null row is undefined, so an out-of-range code is nullified rather than
+    // read past the end of the keys
+    if (this.nullCount === 0) { return Series.new(matches.gather(this._codes(), true)); }
+    // The null mask is indexed from the start of the codes rather than from this Series' offset,
+    // so gather every code up to the end of this Series and view the result from the offset.
+    const indices = this._col.getChild<Uint32>(0);
+    const codes   = new Column({
+      type: new Uint32,
+      data: indices.data,
+      offset: indices.offset,
+      length: this.offset + this.length,
+    });
+    const result  = matches.gather(codes, true);
+    return Series.new(new Column({
+      type: new Bool8,
+      data: result.data,
+      offset: this.offset,
+      length: this.length,
+      nullMask: this.mask,
+      nullCount: this.nullCount,
+    }));
+  }
+
+  /**
+   * The codes of this Series' rows, which start at this Series' offset into the indices child.
+   *
+   * @ignore
+   */
+  protected _codes(): Column<Uint32> {
+    const indices = this._col.getChild<Uint32>(0);
+    if (this.offset === 0 && this.length === indices.length) { return indices; }
+    return new Column({
+      type: new Uint32,
+      data: indices.data,
+      offset: indices.offset + this.offset,
+      length: this.length,
+    });
+  }
+}
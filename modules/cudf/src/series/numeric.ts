@@ -979,11 +979,21 @@ export abstract class NumericSeries<T extends Numeric> extends Series<T> {
    *  Valid values: ’linear’, ‘lower’, ‘higher’, ‘midpoint’, ‘nearest’.
    * @param memoryResource The optional MemoryResource used to allocate the result Series's device
    *   memory.
-   * @returns values at the given quantile.
-   */
-  quantile(q                                         = 0.5,
+   * @returns values at the given quantile, or a Float64Series of the values at each quantile when
+   *   `q` is an array. Multiple quantiles are computed with a single sort of the Series.
+   */
+  quantile(q?: number,
+           interpolation?: keyof typeof Interpolation,
+           memoryResource?: MemoryResource): number;
+  quantile(q: number[],
+           interpolation?: keyof typeof Interpolation,
+           memoryResource?: MemoryResource): Float64Series;
+  quantile(q: number|number[]                        = 0.5,
            interpolation: keyof typeof Interpolation = 'linear',
            memoryResource?: MemoryResource) {
+    if (Array.isArray(q)) {
+      return Series.new(this._col.quantiles(q, Interpolation[interpolation], memoryResource));
+    }
     return this._process_reduction(true)._col.quantile(
       q, Interpolation[interpolation], memoryResource);
   }
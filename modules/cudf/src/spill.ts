@@ -0,0 +1,106 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import {FailureCallbackResourceAdaptor, MemoryResource} from '@nvidia/rmm';
+
+import CUDF from './addon';
+
+export interface SpillOptions {
+  /**
+   * The number of bytes of device memory spillable Columns may hold before the least-recently-used
+   * ones are spilled. Defaults to `Infinity`.
+   */
+  deviceLimit?: number;
+  /**
+   * A directory to write spilled Columns to. If `null` or empty (the default), Columns are spilled
+   * to pinned host memory.
+   */
+  directory?: string|null;
+}
+
+export interface SpillStats {
+  /** The current device memory limit for spillable Columns */
+  deviceLimit: number;
+  /** Bytes of device memory currently held by spillable Columns */
+  deviceBytes: number;
+  /** Bytes currently spilled to host memory or disk */
+  hostBytes: number;
+  /** The number of buffers spilled out of device memory */
+  spillCount: number;
+  /** The number of buffers copied back into device memory */
+  unspillCount: number;
+  /** The total number of bytes spilled out of device memory */
+  spilledBytes: number;
+  /** The total number of bytes copied back into device memory */
+  unspilledBytes: number;
+}
+
+/**
+ * Configure the spill manager for Columns marked `spillable`.
+ *
+ * When the device memory held by spillable Columns exceeds `deviceLimit`, the least-recently-used
+ * spillable Columns are copied to host memory (or `directory`) and their device memory freed.
+ * Columns used during the current turn of the event loop are never spilled automatically.
+ *
+ * The limit only applies when Columns are touched. To also spill when a device allocation fails,
+ * allocate from a MemoryResource created by `spillOnAllocationFailure()`.
+ *
+ * @example
+ * ```typescript
+ * import {DataFrame, setSpillOptions} from '@nvidia/cudf';
+ *
+ * setSpillOptions({deviceLimit: 2 * 1024 ** 3});
+ * const df = DataFrame.readCSV({...}).setSpillable();
+ * ```
+ */
+export function setSpillOptions(options: SpillOptions): void { CUDF.setSpillOptions(options); }
+
+/**
+ * Get the spill manager's counters.
+ */
+export function getSpillStats(): SpillStats { return CUDF.getSpillStats(); }
+
+/**
+ * Spill least-recently-used spillable Columns not used during the current turn of the event loop
+ * until at least `bytes` of device memory have been freed.
+ *
+ * @param bytes The number of bytes to free. Defaults to all spillable device memory.
+ * @returns The number of bytes of device memory freed.
+ */
+export function spill(bytes?: number): number { return CUDF.spill(bytes); }
+
+/**
+ * Create a MemoryResource that spills least-recently-used spillable Columns when an allocation from
+ * `upstreamMemoryResource` fails, then retries the allocation.
+ *
+ * Columns used during the current turn of the event loop aren't spilled, so an allocation can
+ * still fail if they hold most of the device memory. Only allocations made on the JavaScript
+ * thread are retried.
+ *
+ * @example
+ * ```typescript
+ * import {spillOnAllocationFailure} from '@nvidia/cudf';
+ * import {CudaMemoryResource, setCurrentDeviceResource} from '@nvidia/rmm';
+ *
+ * setCurrentDeviceResource(spillOnAllocationFailure(new CudaMemoryResource()));
+ * ```
+ *
+ * @param upstreamMemoryResource The MemoryResource to allocate from.
+ * @param maxRetries The maximum number of times to spill and retry each allocation (default 1).
+ */
+export function spillOnAllocationFailure(upstreamMemoryResource: MemoryResource,
+                                         maxRetries?: number): FailureCallbackResourceAdaptor {
+  return new FailureCallbackResourceAdaptor(
+    upstreamMemoryResource, (byteLength) => spill(byteLength) > 0, maxRetries);
+}
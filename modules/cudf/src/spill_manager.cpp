@@ -0,0 +1,217 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <node_cudf/column.hpp>
+#include <node_cudf/spill_manager.hpp>
+
+#include <node_cuda/utilities/error.hpp>
+
+#include <nv_node/macros.hpp>
+
+#include <cuda_runtime_api.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <vector>
+
+namespace nv {
+
+namespace {
+
+std::string make_spill_file_path(std::string const& directory) {
+  static std::size_t next_id{0};
+  return directory + "/node-cudf-spill-" + std::to_string(::getpid()) + "-" +
+         std::to_string(next_id++) + ".bin";
+}
+
+}  // namespace
+
+SpilledBuffer::SpilledBuffer(Napi::Env const& env, rmm::device_buffer const& buffer)
+  : size_(buffer.size()) {
+  auto const stream     = buffer.stream().value();
+  auto const& directory = SpillManager::get().directory();
+  if (directory.empty()) {
+    NODE_CUDA_TRY(cudaMallocHost(&host_, size_), env);
+    // The destructor doesn't run if the constructor throws, so free the host copy here
+    auto status = cudaMemcpyAsync(host_, buffer.data(), size_, cudaMemcpyDefault, stream);
+    if (status == cudaSuccess) { status = cudaStreamSynchronize(stream); }
+    if (status != cudaSuccess) {
+      cudaFreeHost(host_);
+      host_ = nullptr;
+      NODE_CUDA_THROW(status, env);
+    }
+  } else {
+    std::vector<char> staging(size_);
+    NODE_CUDA_TRY(
+      cudaMemcpyAsync(staging.data(), buffer.data(), size_, cudaMemcpyDefault, stream), env);
+    NODE_CUDA_TRY(cudaStreamSynchronize(stream), env);
+    path_ = make_spill_file_path(directory);
+    std::ofstream file(path_, std::ios::binary | std::ios::trunc);
+    file.write(staging.data(), size_);
+    if (!file) {
+      file.close();
+      std::remove(path_.c_str());
+      NAPI_THROW(Napi::Error::New(env, "Failed to write spill file \"" + path_ + "\""));
+    }
+  }
+  SpillManager::get().record_spill(size_);
+}
+
+SpilledBuffer::~SpilledBuffer() {
+  if (host_ != nullptr) { cudaFreeHost(host_); }
+  if (!path_.empty()) { std::remove(path_.c_str()); }
+  SpillManager::get().release_host(size_);
+}
+
+void SpilledBuffer::copy_to(Napi::Env const& env, rmm::device_buffer& buffer) const {
+  auto const stream = buffer.stream();
+  buffer.resize(size_, stream);
+  if (host_ != nullptr) {
+    NODE_CUDA_TRY(
+      cudaMemcpyAsync(buffer.data(), host_, size_, cudaMemcpyDefault, stream.value()), env);
+    NODE_CUDA_TRY(cudaStreamSynchronize(stream.value()), env);
+  } else {
+    std::vector<char> staging(size_);
+    std::ifstream file(path_, std::ios::binary);
+    file.read(staging.data(), size_);
+    if (!file) {
+      NAPI_THROW(Napi::Error::New(env, "Failed to read spill file \"" + path_ + "\""));
+    }
+    NODE_CUDA_TRY(
+      cudaMemcpyAsync(buffer.data(), staging.data(), size_, cudaMemcpyDefault, stream.value()),
+      env);
+    NODE_CUDA_TRY(cudaStreamSynchronize(stream.value()), env);
+  }
+  SpillManager::get().record_unspill(size_);
+}
+
+SpillManager& SpillManager::get() {
+  static SpillManager manager;
+  return manager;
+}
+
+Napi::Object SpillManager::Init(Napi::Env env, Napi::Object exports) {
+  EXPORT_FUNC(env, exports, "setSpillOptions", SpillManager::set_spill_options);
+  EXPORT_FUNC(env, exports, "getSpillStats", SpillManager::get_spill_stats);
+  EXPORT_FUNC(env, exports, "spill", SpillManager::spill_device_memory);
+  return exports;
+}
+
+void SpillManager::advance_epoch_on_next_tick(Napi::Env const& env) {
+  if (epoch_scheduled_) { return; }
+  epoch_scheduled_   = true;
+  auto set_immediate = env.Global().Get("setImmediate").As<Napi::Function>();
+  set_immediate.Call({Napi::Function::New(env, [](Napi::CallbackInfo const&) {
+    auto& manager            = SpillManager::get();
+    manager.epoch_scheduled_ = false;
+    ++manager.epoch_;
+  })});
+}
+
+void SpillManager::touch(Column const& column) {
+  advance_epoch_on_next_tick(column.Env());
+  auto const bytes = column.device_bytes();
+  auto iter        = entries_.find(&column);
+  if (iter == entries_.end()) {
+    lru_.push_back(&column);
+    entries_.emplace(&column, entry{std::prev(lru_.end()), epoch_, bytes});
+    device_bytes_ += bytes;
+  } else {
+    lru_.splice(lru_.end(), lru_, iter->second.position);
+    device_bytes_ += bytes - iter->second.bytes;
+    iter->second.epoch = epoch_;
+    iter->second.bytes = bytes;
+  }
+  if (device_bytes_ > device_limit_) { spill(device_bytes_ - device_limit_); }
+}
+
+void SpillManager::untrack(Column const& column) {
+  auto iter = entries_.find(&column);
+  if (iter != entries_.end()) {
+    device_bytes_ -= iter->second.bytes;
+    lru_.erase(iter->second.position);
+    entries_.erase(iter);
+  }
+}
+
+std::size_t SpillManager::spill_column(Column const& column) {
+  auto const freed = column.spill();
+  auto iter        = entries_.find(&column);
+  if (iter != entries_.end()) {
+    device_bytes_ -= iter->second.bytes;
+    iter->second.bytes = 0;
+  }
+  return freed;
+}
+
+std::size_t SpillManager::spill(std::size_t bytes) {
+  std::size_t freed{0};
+  for (auto column : lru_) {
+    if (freed >= bytes) { break; }
+    auto const& entry = entries_.at(column);
+    if (entry.epoch == epoch_ || entry.bytes == 0) { continue; }
+    freed += spill_column(*column);
+  }
+  return freed;
+}
+
+Napi::Value SpillManager::set_spill_options(Napi::CallbackInfo const& info) {
+  auto& manager = SpillManager::get();
+  auto options  = info[0].ToObject();
+  if (options.Has("deviceLimit")) {
+    double const limit    = options.Get("deviceLimit").ToNumber();
+    manager.device_limit_ = std::isfinite(limit) && limit >= 0
+                              ? static_cast<std::size_t>(limit)
+                              : limit < 0 ? 0 : SIZE_MAX;
+  }
+  if (options.Has("directory")) {
+    auto const directory = options.Get("directory");
+    manager.directory_   = directory.IsString() ? directory.ToString().Utf8Value() : "";
+  }
+  if (manager.device_bytes_ > manager.device_limit_) {
+    manager.spill(manager.device_bytes_ - manager.device_limit_);
+  }
+  return info.Env().Undefined();
+}
+
+Napi::Value SpillManager::get_spill_stats(Napi::CallbackInfo const& info) {
+  auto& manager = SpillManager::get();
+  auto env      = info.Env();
+  auto stats    = Napi::Object::New(env);
+  stats.Set("deviceLimit",
+            manager.device_limit_ == SIZE_MAX
+              ? Napi::Number::New(env, std::numeric_limits<double>::infinity())
+              : Napi::Number::New(env, manager.device_limit_));
+  stats.Set("deviceBytes", Napi::Number::New(env, manager.device_bytes_));
+  stats.Set("hostBytes", Napi::Number::New(env, manager.host_bytes_));
+  stats.Set("spillCount", Napi::Number::New(env, manager.spill_count_));
+  stats.Set("unspillCount", Napi::Number::New(env, manager.unspill_count_));
+  stats.Set("spilledBytes", Napi::Number::New(env, manager.spilled_bytes_));
+  stats.Set("unspilledBytes", Napi::Number::New(env, manager.unspilled_bytes_));
+  return stats;
+}
+
+Napi::Value SpillManager::spill_device_memory(Napi::CallbackInfo const& info) {
+  auto& manager      = SpillManager::get();
+  double const bytes = info[0].IsNumber() ? info[0].ToNumber().DoubleValue()
+                                          : static_cast<double>(manager.device_bytes_);
+  auto const freed   = manager.spill(static_cast<std::size_t>(std::max(0.0, bytes)));
+  return Napi::Number::New(info.Env(), freed);
+}
+
+}  // namespace nv
@@ -0,0 +1,46 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import CUDF from './addon';
+
+/**
+ * Get the CUDA stream on which cudf operations are currently enqueued.
+ */
+export function getCurrentStream(): number { return CUDF.getCurrentStream(); }
+
+/**
+ * Enqueue the cudf operations issued by `fn` on `stream`, then restore the previous stream.
+ *
+ * Only work issued synchronously inside `fn` is affected. Reductions, groupby aggregations and
+ * Table joins still run on the default stream. They are ordered with `stream` by the legacy
+ * default stream semantics only if `stream` was created without `cudaStreamNonBlocking`.
+ *
+ * @param stream The stream to enqueue operations on, for example from `DeviceBuffer.stream`.
+ * @param fn The function that issues the operations.
+ * @returns The return value of `fn`.
+ *
+ * @example
+ * ```typescript
+ * import {Series, withStream} from '@nvidia/cudf';
+ *
+ * const a = Series.new([1, 2, 3]);
+ * const b = withStream(stream, () => a.add(1).filter(a.gt(1)));
+ * ```
+ */
+export function withStream<T>(stream: number, fn: () => T): T {
+  const prev = CUDF.setCurrentStream(stream);
+  try {
+    return fn();
+  } finally { CUDF.setCurrentStream(prev); }
+}
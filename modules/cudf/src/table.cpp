@@ -16,8 +16,10 @@
 #include "node_cudf/column.hpp"
 #include "node_cudf/utilities/error.hpp"
 #include "node_cudf/utilities/napi_to_cpp.hpp"
+#include "node_cudf/utilities/stream.hpp"
 
 #include <cudf/column/column.hpp>
+#include <cudf/detail/sorting.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/types.hpp>
 
@@ -38,13 +40,29 @@ Napi::Object Table::Init(Napi::Env env, Napi::Object exports) {
                                       InstanceAccessor<&Table::num_columns>("numColumns"),
                                       InstanceAccessor<&Table::num_rows>("numRows"),
                                       InstanceMethod<&Table::gather>("gather"),
+                                      InstanceMethod<&Table::slice>("slice"),
+                                      InstanceMethod<&Table::split>("split"),
+                                      InstanceMethod<&Table::hash_partition>("hashPartition"),
                                       InstanceMethod<&Table::get_column>("getColumnByIndex"),
                                       InstanceMethod<&Table::to_arrow>("toArrow"),
                                       InstanceMethod<&Table::order_by>("orderBy"),
+                                      InstanceMethod<&Table::sort_by_key>("sortByKey"),
+                                      InstanceMethod<&Table::stable_sort_by_key>(
+                                        "stableSortByKey"),
+                                      InstanceMethod<&Table::top_k>("topK"),
                                       StaticMethod<&Table::read_csv>("readCSV"),
+                                      StaticMethod<&Table::read_parquet>("readParquet"),
                                       InstanceMethod<&Table::write_csv>("writeCSV"),
                                       InstanceMethod<&Table::drop_nans>("drop_nans"),
                                       InstanceMethod<&Table::drop_nulls>("drop_nulls"),
+                                      InstanceMethod<&Table::drop_duplicates>("dropDuplicates"),
+                                      InstanceMethod<&Table::distinct_count>("distinctCount"),
+                                      InstanceMethod<&Table::reduce_all>("reduceAll"),
+                                      InstanceMethod<&Table::inner_join>("innerJoin"),
+                                      InstanceMethod<&Table::left_join>("leftJoin"),
+                                      InstanceMethod<&Table::full_join>("fullJoin"),
+                                      InstanceMethod<&Table::left_semi_join>("leftSemiJoin"),
+                                      InstanceMethod<&Table::left_anti_join>("leftAntiJoin"),
                                     });
 
   Table::constructor = Napi::Persistent(ctor);
@@ -146,7 +164,11 @@ Napi::Value Table::gather(Napi::CallbackInfo const& info) {
   if (selection.type().id() == cudf::type_id::BOOL8) {
     return this->apply_boolean_mask(selection)->Value();
   }
-  return this->gather(selection)->Value();
+  bool const nullify = args.Length() > 1 && args[1].IsBoolean() && args[1].ToBoolean();
+  return this
+    ->gather(selection,
+             nullify ? cudf::out_of_bounds_policy::NULLIFY : cudf::out_of_bounds_policy::DONT_CHECK)
+    ->Value();
 }
 
 Napi::Value Table::get_column(Napi::CallbackInfo const& info) {
@@ -190,7 +212,7 @@ Napi::Value Table::order_by(Napi::CallbackInfo const& info) {
   }
 
   std::unique_ptr<cudf::column> result =
-    cudf::sorted_order(table_view, column_order, null_precedece);
+    cudf::detail::sorted_order(table_view, column_order, null_precedece, get_current_stream());
 
   return Column::New(std::move(result))->Value();
 }
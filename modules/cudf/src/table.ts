@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+import {MemoryResource} from '@nvidia/rmm';
+
 import CUDF from './addon';
 import {Column} from './column';
 import {CSVTypeMap, ReadCSVOptions, WriteCSVOptions} from './types/csv';
@@ -24,6 +26,8 @@ import {
 import {
   NullOrder,
 } from './types/enums';
+import {Interpolation, Reduction} from './types/mappings';
+import {ReadParquetOptions} from './types/parquet';
 
 export type ToArrowMetadata = [string | number, ToArrowMetadata[]?];
 
@@ -48,6 +52,14 @@ interface TableConstructor {
    */
   readCSV<T extends CSVTypeMap = any>(options: ReadCSVOptions<T>):
     {names: (keyof T)[], table: Table};
+
+  /**
+   * Reads a Parquet dataset into a set of columns.
+   *
+   * @param options Settings for controlling reading behavior.
+   * @return The Parquet data as a Table and a list of column names.
+   */
+  readParquet(options: ReadParquetOptions): {names: string[], table: Table};
 }
 
 /**
@@ -68,8 +80,38 @@ export interface Table {
    * Return sub-selection from a Table
    *
    * @param selection
+   * @param nullifyOutOfBounds If true, rows for out-of-bounds indices in `selection` are null.
+   *   Otherwise out-of-bounds indices are undefined behavior.
+   */
+  gather(selection: Column<IndexType|Bool8>, nullifyOutOfBounds?: boolean): Table;
+
+  /**
+   * Return zero-copy Tables of row ranges. The Tables' Columns share this Table's device memory.
+   *
+   * @param indices An even number of row indices, the begin and (exclusive) end of each range.
+   */
+  slice(indices: number[]): Table[];
+
+  /**
+   * Return zero-copy Tables of the rows between consecutive split points, i.e.
+   * `[0, splits[0])`, `[splits[0], splits[1])`, ..., `[splits[n - 1], numRows)`.
+   *
+   * @param splits Ascending row indices to split at.
+   */
+  split(splits: number[]): Table[];
+
+  /**
+   * Partition this Table's rows by the hash of key columns in a single pass.
+   *
+   * @param keys The indices of the key columns to hash.
+   * @param numPartitions The number of partitions.
+   * @param memoryResource The optional MemoryResource used to allocate the result Table's device
+   *   memory.
+   * @returns The rows ordered by partition, and the row offset where each partition starts.
+   *   Pass `offsets.slice(1)` to `split()` to get each partition as a zero-copy Table.
    */
-  gather(selection: Column<IndexType|Bool8>): Table;
+  hashPartition(keys: number[], numPartitions: number, memoryResource?: MemoryResource):
+    {table: Table, offsets: number[]};
 
   /**
    * Get the Column at a specified index
@@ -91,6 +133,63 @@ export interface Table {
    * @returns Column of permutation indices for the desired sort order
    */
   orderBy(column_orders: boolean[], null_orders: NullOrder[]): Column<Int32>;
+
+  /**
+   * Sort this Table's rows by the rows of a Table of sort keys in a single pass.
+   *
+   * @param keys The Table of sort keys. Must have the same number of rows as this Table.
+   * @param column_orders The desired sort order for each key column (true for ascending).
+   * @param null_orders Indicates how null values compare against all other values in each key
+   *   column.
+   * @param memoryResource The optional MemoryResource used to allocate the result Table's device
+   *   memory.
+   * @returns The sorted Table
+   */
+  sortByKey(keys: Table,
+            column_orders: boolean[],
+            null_orders: NullOrder[],
+            memoryResource?: MemoryResource): Table;
+
+  /**
+   * Sort this Table's rows by the rows of a Table of sort keys, preserving the relative order of
+   * rows with equal keys.
+   *
+   * @param keys The Table of sort keys. Must have the same number of rows as this Table.
+   * @param column_orders The desired sort order for each key column (true for ascending).
+   * @param null_orders Indicates how null values compare against all other values in each key
+   *   column.
+   * @param memoryResource The optional MemoryResource used to allocate the result Table's device
+   *   memory.
+   * @returns The sorted Table
+   */
+  stableSortByKey(keys: Table,
+                  column_orders: boolean[],
+                  null_orders: NullOrder[],
+                  memoryResource?: MemoryResource): Table;
+
+  /**
+   * Return the first `k` of this Table's rows when stable-sorted by a Table of sort keys. Only
+   * the selected rows are gathered.
+   *
+   * When the first key column is numeric or a timestamp with no nulls and `k` is small relative
+   * to the number of rows, a threshold sampled from that column filters the rows in one O(n)
+   * pass, and only the remaining candidates are sorted. Otherwise every row is stable-sorted,
+   * which costs O(n log n).
+   *
+   * @param keys The Table of sort keys. Must have the same number of rows as this Table.
+   * @param k The number of rows to return.
+   * @param column_orders The desired sort order for each key column (true for ascending).
+   * @param null_orders Indicates how null values compare against all other values in each key
+   *   column.
+   * @param memoryResource The optional MemoryResource used to allocate the result Table's device
+   *   memory.
+   * @returns A Table of at most `k` rows
+   */
+  topK(keys: Table,
+       k: number,
+       column_orders: boolean[],
+       null_orders: NullOrder[],
+       memoryResource?: MemoryResource): Table;
   toArrow(names: ToArrowMetadata[]): Uint8Array;
 
   /**
@@ -99,8 +198,110 @@ export interface Table {
    */
   writeCSV(options: TableWriteCSVOptions): void;
 
+  /**
+   * Compute each of the named reductions, and optionally a set of quantiles, over every column of
+   * this Table. All the reductions are launched before any result is copied back to the host, so
+   * the host only waits on the device once.
+   *
+   * @param aggs The reductions to compute.
+   * @param quantiles The quantiles to compute, 0 <= q <= 1. Each column is sorted once for all
+   *   of them.
+   * @param interpolation The interpolation used when a quantile lies between two elements.
+   * @param memoryResource The optional MemoryResource used to allocate temporary device memory.
+   * @returns An object mapping each reduction name to its result for each column, and
+   *   `quantiles` to the result of each quantile for each column.
+   */
+  reduceAll<R extends Reduction>(aggs: R[],
+                                 quantiles?: number[],
+                                 interpolation?: Interpolation,
+                                 memoryResource?: MemoryResource):
+    {[P in R]: any[]}&{quantiles?: any[][]};
+
   drop_nans(keys: number[], threshold: number): Table;
   drop_nulls(keys: number[], threshold: number): Table;
+
+  /**
+   * Remove duplicate rows, comparing rows by the key columns. The result is sorted by the keys.
+   *
+   * @param keys The indices of the key columns.
+   * @param keep Which row of each set of duplicates to keep: 'first', 'last', or 'none'.
+   * @param nullsEqual Whether null keys are considered equal.
+   * @param memoryResource The optional MemoryResource used to allocate the result Table's device
+   *   memory.
+   */
+  dropDuplicates(keys: number[],
+                 keep: 'first'|'last'|'none',
+                 nullsEqual: boolean,
+                 memoryResource?: MemoryResource): Table;
+
+  /**
+   * Count the exact number of distinct rows.
+   *
+   * @param nullsEqual Whether null elements are considered equal (default true).
+   */
+  distinctCount(nullsEqual?: boolean): number;
+
+  /**
+   * Compute the row indices of the inner join of this Table's rows with another Table's rows.
+   *
+   * @param right The right Table of join keys.
+   * @param nullEquality Whether null keys are considered equal.
+   * @param memoryResource The optional MemoryResource used to allocate the result Columns' device
+   *   memory.
+   * @returns A pair of [left, right] gather maps.
+   */
+  innerJoin(right: Table, nullEquality: boolean, memoryResource?: MemoryResource):
+    [Column<Int32>, Column<Int32>];
+
+  /**
+   * Compute the row indices of the left join of this Table's rows with another Table's rows.
+   * Left rows without a match have an out-of-bounds right row index.
+   *
+   * @param right The right Table of join keys.
+   * @param nullEquality Whether null keys are considered equal.
+   * @param memoryResource The optional MemoryResource used to allocate the result Columns' device
+   *   memory.
+   * @returns A pair of [left, right] gather maps.
+   */
+  leftJoin(right: Table, nullEquality: boolean, memoryResource?: MemoryResource):
+    [Column<Int32>, Column<Int32>];
+
+  /**
+   * Compute the row indices of the full join of this Table's rows with another Table's rows.
+   * Rows without a match have an out-of-bounds row index on the other side.
+   *
+   * @param right The right Table of join keys.
+   * @param nullEquality Whether null keys are considered equal.
+   * @param memoryResource The optional MemoryResource used to allocate the result Columns' device
+   *   memory.
+   * @returns A pair of [left, right] gather maps.
+   */
+  fullJoin(right: Table, nullEquality: boolean, memoryResource?: MemoryResource):
+    [Column<Int32>, Column<Int32>];
+
+  /**
+   * Compute the indices of this Table's rows that have a match in another Table.
+   *
+   * @param right The right Table of join keys.
+   * @param nullEquality Whether null keys are considered equal.
+   * @param memoryResource The optional MemoryResource used to allocate the result Column's device
+   *   memory.
+   * @returns A gather map of left row indices.
+   */
+  leftSemiJoin(right: Table, nullEquality: boolean, memoryResource?: MemoryResource):
+    Column<Int32>;
+
+  /**
+   * Compute the indices of this Table's rows that have no match in another Table.
+   *
+   * @param right The right Table of join keys.
+   * @param nullEquality Whether null keys are considered equal.
+   * @param memoryResource The optional MemoryResource used to allocate the result Column's device
+   *   memory.
+   * @returns A gather map of left row indices.
+   */
+  leftAntiJoin(right: Table, nullEquality: boolean, memoryResource?: MemoryResource):
+    Column<Int32>;
 }
 
 // eslint-disable-next-line @typescript-eslint/no-redeclare
@@ -14,18 +14,84 @@
 
 #include <node_cudf/column.hpp>
 #include <node_cudf/table.hpp>
+#include <node_cudf/utilities/error.hpp>
+#include <node_cudf/utilities/stream.hpp>
+
+#include <nv_node/utilities/args.hpp>
 
 #include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/table/table_view.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace nv {
 
+namespace {
+
+Napi::Array tables_to_array(Napi::Env const& env, std::vector<ObjectUnwrap<Table>> const& tables) {
+  auto ary = Napi::Array::New(env, tables.size());
+  for (std::size_t i = 0; i < tables.size(); ++i) { ary.Set(i, tables[i]->Value()); }
+  return ary;
+}
+
+}  // namespace
+
 ObjectUnwrap<Table> Table::gather(Column const& gather_map,
                                   cudf::out_of_bounds_policy bounds_policy,
                                   rmm::mr::device_memory_resource* mr) const {
-  return Table::New(cudf::gather(cudf::table_view{{*this}}, gather_map, bounds_policy, mr));
+  return Table::New(cudf::detail::gather(cudf::table_view{{*this}},
+                                         gather_map,
+                                         bounds_policy,
+                                         cudf::detail::negative_index_policy::ALLOWED,
+                                         get_current_stream(),
+                                         mr));
+}
+
+std::vector<ObjectUnwrap<Table>> Table::slice(std::vector<cudf::size_type> const& indices) const {
+  auto env = Env();
+  NODE_CUDF_EXPECT(indices.size() % 2 == 0, "slice expects an even number of indices", env);
+
+  std::vector<ObjectUnwrap<Table>> tables;
+  tables.reserve(indices.size() / 2);
+  for (std::size_t i = 0; i < indices.size(); i += 2) {
+    auto const begin = indices[i];
+    auto const end   = indices[i + 1];
+    NODE_CUDF_EXPECT(0 <= begin && begin <= end && end <= num_rows(),
+                     "Slice bounds out of range",
+                     env);
+    auto columns = Napi::Array::New(env, num_columns());
+    for (cudf::size_type j = 0; j < num_columns(); ++j) {
+      columns.Set(j, get_column(j).slice(begin, end)->Value());
+    }
+    tables.push_back(Table::New(columns));
+  }
+  return tables;
+}
+
+std::vector<ObjectUnwrap<Table>> Table::split(std::vector<cudf::size_type> const& splits) const {
+  std::vector<cudf::size_type> indices;
+  indices.reserve(2 * splits.size() + 2);
+  indices.push_back(0);
+  for (auto split : splits) {
+    indices.push_back(split);
+    indices.push_back(split);
+  }
+  indices.push_back(num_rows());
+  return slice(indices);
+}
+
+Napi::Value Table::slice(Napi::CallbackInfo const& info) {
+  CallbackArgs args{info};
+  std::vector<cudf::size_type> indices = args[0];
+  return tables_to_array(info.Env(), slice(indices));
+}
+
+Napi::Value Table::split(Napi::CallbackInfo const& info) {
+  CallbackArgs args{info};
+  std::vector<cudf::size_type> splits = args[0];
+  return tables_to_array(info.Env(), split(splits));
 }
 
 }  // namespace nv
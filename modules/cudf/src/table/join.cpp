@@ -0,0 +1,102 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <node_cudf/column.hpp>
+#include <node_cudf/table.hpp>
+#include <node_cudf/utilities/error.hpp>
+#include <node_cudf/utilities/gather_maps.hpp>
+#include <node_cudf/utilities/napi_to_cpp.hpp>
+
+#include <node_rmm/utilities/napi_to_cpp.hpp>
+
+#include <nv_node/utilities/args.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/join.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <memory>
+#include <utility>
+
+namespace nv {
+
+std::pair<ObjectUnwrap<Column>, ObjectUnwrap<Column>> Table::inner_join(
+  Table const& right,
+  cudf::null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr) const {
+  return gather_maps_to_columns(cudf::inner_join(*this, right, compare_nulls, mr));
+}
+
+std::pair<ObjectUnwrap<Column>, ObjectUnwrap<Column>> Table::left_join(
+  Table const& right,
+  cudf::null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr) const {
+  return gather_maps_to_columns(cudf::left_join(*this, right, compare_nulls, mr));
+}
+
+std::pair<ObjectUnwrap<Column>, ObjectUnwrap<Column>> Table::full_join(
+  Table const& right,
+  cudf::null_equality compare_nulls,
+  rmm::mr::device_memory_resource* mr) const {
+  return gather_maps_to_columns(cudf::full_join(*this, right, compare_nulls, mr));
+}
+
+ObjectUnwrap<Column> Table::left_semi_join(Table const& right,
+                                           cudf::null_equality compare_nulls,
+                                           rmm::mr::device_memory_resource* mr) const {
+  return gather_map_to_column(cudf::left_semi_join(*this, right, compare_nulls, mr));
+}
+
+ObjectUnwrap<Column> Table::left_anti_join(Table const& right,
+                                           cudf::null_equality compare_nulls,
+                                           rmm::mr::device_memory_resource* mr) const {
+  return gather_map_to_column(cudf::left_anti_join(*this, right, compare_nulls, mr));
+}
+
+Napi::Value Table::inner_join(Napi::CallbackInfo const& info) {
+  CallbackArgs args{info};
+  NODE_CUDF_EXPECT(Table::is_instance(args[0]), "innerJoin expects a right Table", info.Env());
+  return gather_maps_to_array(info.Env(),
+                              inner_join(*Table::Unwrap(args[0].ToObject()), args[1], args[2]));
+}
+
+Napi::Value Table::left_join(Napi::CallbackInfo const& info) {
+  CallbackArgs args{info};
+  NODE_CUDF_EXPECT(Table::is_instance(args[0]), "leftJoin expects a right Table", info.Env());
+  return gather_maps_to_array(info.Env(),
+                              left_join(*Table::Unwrap(args[0].ToObject()), args[1], args[2]));
+}
+
+Napi::Value Table::full_join(Napi::CallbackInfo const& info) {
+  CallbackArgs args{info};
+  NODE_CUDF_EXPECT(Table::is_instance(args[0]), "fullJoin expects a right Table", info.Env());
+  return gather_maps_to_array(info.Env(),
+                              full_join(*Table::Unwrap(args[0].ToObject()), args[1], args[2]));
+}
+
+Napi::Value Table::left_semi_join(Napi::CallbackInfo const& info) {
+  CallbackArgs args{info};
+  NODE_CUDF_EXPECT(Table::is_instance(args[0]), "leftSemiJoin expects a right Table", info.Env());
+  return left_semi_join(*Table::Unwrap(args[0].ToObject()), args[1], args[2])->Value();
+}
+
+Napi::Value Table::left_anti_join(Napi::CallbackInfo const& info) {
+  CallbackArgs args{info};
+  NODE_CUDF_EXPECT(Table::is_instance(args[0]), "leftAntiJoin expects a right Table", info.Env());
+  return left_anti_join(*Table::Unwrap(args[0].ToObject()), args[1], args[2])->Value();
+}
+
+}  // namespace nv
@@ -0,0 +1,54 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <node_cudf/table.hpp>
+#include <node_cudf/utilities/error.hpp>
+
+#include <node_rmm/utilities/napi_to_cpp.hpp>
+
+#include <nv_node/utilities/args.hpp>
+#include <nv_node/utilities/cpp_to_napi.hpp>
+
+#include <cudf/partitioning.hpp>
+#include <cudf/types.hpp>
+
+#include <napi.h>
+
+#include <vector>
+
+namespace nv {
+
+std::pair<ObjectUnwrap<Table>, std::vector<cudf::size_type>> Table::hash_partition(
+  std::vector<cudf::size_type> const& keys,
+  cudf::size_type num_partitions,
+  rmm::mr::device_memory_resource* mr) const {
+  NODE_CUDF_EXPECT(num_partitions > 0, "hashPartition expects at least one partition", Env());
+  auto result =
+    cudf::hash_partition(*this, keys, num_partitions, cudf::hash_id::HASH_MURMUR3, mr);
+  return {Table::New(std::move(result.first)), std::move(result.second)};
+}
+
+Napi::Value Table::hash_partition(Napi::CallbackInfo const& info) {
+  CallbackArgs args{info};
+  std::vector<cudf::size_type> keys   = args[0];
+  cudf::size_type num_partitions      = args[1];
+  rmm::mr::device_memory_resource* mr = args[2];
+  auto result                         = hash_partition(keys, num_partitions, mr);
+  auto output                         = Napi::Object::New(info.Env());
+  output.Set("table", result.first->Value());
+  output.Set("offsets", CPPToNapi(info)(result.second));
+  return output;
+}
+
+}  // namespace nv
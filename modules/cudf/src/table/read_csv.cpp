@@ -14,11 +14,17 @@
 
 #include <node_cudf/column.hpp>
 #include <node_cudf/table.hpp>
+#include <node_cudf/utilities/error.hpp>
+#include <node_cudf/utilities/io.hpp>
 
 #include <cudf/io/csv.hpp>
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/types.hpp>
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
 namespace nv {
 
 namespace {
@@ -193,15 +199,6 @@ cudf::io::csv_reader_options make_reader_options(Napi::Object const& options,
   return opts;
 }
 
-std::vector<cudf::io::host_buffer> get_host_buffers(std::vector<Span<char>> const& sources) {
-  std::vector<cudf::io::host_buffer> buffers;
-  buffers.reserve(sources.size());
-  std::transform(sources.begin(), sources.end(), std::back_inserter(buffers), [&](auto const& buf) {
-    return cudf::io::host_buffer{buf.data(), buf.size()};
-  });
-  return buffers;
-}
-
 Napi::Array get_output_names(Napi::Env const& env, cudf::io::table_with_metadata const& result) {
   auto const& column_names = result.metadata.column_names;
   auto names               = Napi::Array::New(env, column_names.size());
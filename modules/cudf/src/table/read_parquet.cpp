@@ -0,0 +1,120 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <node_cudf/column.hpp>
+#include <node_cudf/table.hpp>
+#include <node_cudf/utilities/error.hpp>
+#include <node_cudf/utilities/io.hpp>
+
+#include <cudf/io/datasource.hpp>
+#include <cudf/io/parquet.hpp>
+#include <cudf/io/types.hpp>
+
+#include <string>
+#include <vector>
+
+namespace nv {
+
+namespace {
+
+cudf::io::parquet_reader_options make_reader_options(Napi::Object const& options,
+                                                     cudf::io::source_info const& source) {
+  auto env     = options.Env();
+  auto is_null = [](Napi::Value const& val) {
+    return val.IsNull() || val.IsEmpty() || val.IsUndefined();
+  };
+  auto has_opt  = [&](std::string const& key) { return options.Has(key); };
+  auto napi_opt = [&](std::string const& key) -> Napi::Value {
+    return has_opt(key) ? options.Get(key) : env.Undefined();
+  };
+  auto long_opt = [&](std::string const& key, int32_t default_val) {
+    return has_opt(key) && !is_null(options.Get(key)) ? options.Get(key).ToNumber().Int32Value()
+                                                      : default_val;
+  };
+  auto bool_opt = [&](std::string const& key, bool default_val) {
+    return has_opt(key) ? options.Get(key).ToBoolean() == true : default_val;
+  };
+
+  auto opts = std::move(cudf::io::parquet_reader_options::builder(source)
+                          .use_pandas_metadata(bool_opt("usePandasMetadata", true))
+                          .build());
+
+  auto columns    = napi_opt("columns");
+  auto row_groups = napi_opt("rowGroups");
+
+  // set the column names to return
+  if (!is_null(columns) && columns.IsArray()) {
+    opts.set_columns(NapiToCPP{columns}.operator std::vector<std::string>());
+  }
+  // row groups and row ranges are mutually exclusive
+  if (!is_null(row_groups) && row_groups.IsArray()) {
+    auto groups = row_groups.As<Napi::Array>();
+    std::vector<std::vector<cudf::size_type>> row_group_indices;
+    row_group_indices.reserve(groups.Length());
+    for (uint32_t i = 0; i < groups.Length(); ++i) {
+      row_group_indices.push_back(
+        NapiToCPP{groups.Get(i)}.operator std::vector<cudf::size_type>());
+    }
+    opts.set_row_groups(row_group_indices);
+  } else {
+    opts.set_skip_rows(long_opt("skipRows", 0));
+    opts.set_num_rows(long_opt("numRows", -1));
+  }
+
+  return opts;
+}
+
+Napi::Value read_parquet_sources(Napi::Object const& options,
+                                 cudf::io::source_info const& source) {
+  auto env    = options.Env();
+  auto result = cudf::io::read_parquet(make_reader_options(options, source));
+
+  auto const& column_names = result.metadata.column_names;
+  auto names               = Napi::Array::New(env, column_names.size());
+  for (std::size_t i = 0; i < column_names.size(); ++i) { names.Set(i, column_names[i]); }
+
+  auto contents = result.tbl->release();
+  auto columns  = Napi::Array::New(env, contents.size());
+  for (std::size_t i = 0; i < contents.size(); ++i) {
+    columns.Set(i, Column::New(std::move(contents[i]))->Value());
+  }
+
+  auto output = Napi::Object::New(env);
+  output.Set("names", names);
+  output.Set("table", Table::New(columns));
+  return output;
+}
+
+}  // namespace
+
+Napi::Value Table::read_parquet(Napi::CallbackInfo const& info) {
+  NODE_CUDF_EXPECT(
+    info[0].IsObject(), "readParquet expects an Object of ReadParquetOptions", info.Env());
+
+  auto options = info[0].As<Napi::Object>();
+  auto sources = options.Get("sources");
+
+  NODE_CUDF_EXPECT(
+    sources.IsArray(), "readParquet expects an Array of paths or buffers", info.Env());
+
+  if (options.Get("sourceType").ToString().Utf8Value() == "files") {
+    return read_parquet_sources(
+      options, cudf::io::source_info{NapiToCPP{sources}.operator std::vector<std::string>()});
+  }
+  return read_parquet_sources(
+    options,
+    cudf::io::source_info{get_host_buffers(NapiToCPP{sources}.operator std::vector<Span<char>>())});
+}
+
+}  // namespace nv
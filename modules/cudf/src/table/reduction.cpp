@@ -0,0 +1,135 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <node_cudf/column.hpp>
+#include <node_cudf/scalar.hpp>
+#include <node_cudf/table.hpp>
+
+#include <node_rmm/utilities/napi_to_cpp.hpp>
+
+#include <nv_node/utilities/args.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <string>
+#include <vector>
+
+namespace nv {
+
+namespace {
+
+// Launches the named reduction without reading its result back to the host. Reductions that
+// would have to wait on the device to produce their result (like "count" on a Column with an
+// unknown null count) are left for `count_column`, called after everything else is launched.
+ObjectUnwrap<Scalar> reduce_column(Column const& col,
+                                   std::string const& agg,
+                                   rmm::mr::device_memory_resource* mr) {
+  if (agg == "min") { return col.minmax(mr).first; }
+  if (agg == "max") { return col.minmax(mr).second; }
+  if (agg == "sum") { return col.sum(mr); }
+  if (agg == "product") { return col.product(mr); }
+  if (agg == "sum_of_squares") { return col.sum_of_squares(mr); }
+  if (agg == "mean") { return col.mean(mr); }
+  if (agg == "median") { return col.median(mr); }
+  if (agg == "var") { return col.variance(1, mr); }
+  if (agg == "std") { return col.std(1, mr); }
+  if (agg == "nunique") {
+    // Not Column::nunique(), which reads the count back to cache it
+    auto const dtype = cudf::data_type{cudf::type_to_id<cudf::size_type>()};
+    return col.reduce(cudf::make_nunique_aggregation(cudf::null_policy::EXCLUDE), dtype, mr);
+  }
+  if (agg == "any") {
+    return col.reduce(cudf::make_any_aggregation(), cudf::data_type{cudf::type_id::BOOL8}, mr);
+  }
+  if (agg == "all") {
+    return col.reduce(cudf::make_all_aggregation(), cudf::data_type{cudf::type_id::BOOL8}, mr);
+  }
+  NAPI_THROW(Napi::Error::New(col.Env(), "Unknown reduction '" + agg + "'"));
+}
+
+ObjectUnwrap<Scalar> count_column(Column const& col) {
+  auto const dtype = cudf::data_type{cudf::type_to_id<cudf::size_type>()};
+  return Scalar::New(Napi::Number::New(col.Env(), col.size() - col.null_count()), dtype);
+}
+
+}  // namespace
+
+std::vector<std::vector<ObjectUnwrap<Scalar>>> Table::reduce_all(
+  std::vector<std::string> const& aggs,
+  std::vector<double> const& quantiles,
+  cudf::interpolation interpolation,
+  rmm::mr::device_memory_resource* mr) const {
+  std::vector<std::vector<ObjectUnwrap<Scalar>>> results(aggs.size() + quantiles.size());
+  for (auto& row : results) { row.reserve(num_columns()); }
+
+  for (std::size_t i = 0; i < aggs.size(); ++i) {
+    if (aggs[i] == "count") { continue; }
+    for (cudf::size_type j = 0; j < num_columns(); ++j) {
+      results[i].push_back(reduce_column(get_column(j), aggs[i], mr));
+    }
+  }
+
+  if (!quantiles.empty()) {
+    for (cudf::size_type j = 0; j < num_columns(); ++j) {
+      // One sort per Column for all the quantiles
+      auto qs = get_column(j).quantiles(quantiles, interpolation, mr);
+      for (std::size_t k = 0; k < quantiles.size(); ++k) {
+        results[aggs.size() + k].push_back(
+          Scalar::New(cudf::get_element(*qs, static_cast<cudf::size_type>(k), mr)));
+      }
+    }
+  }
+
+  for (std::size_t i = 0; i < aggs.size(); ++i) {
+    if (aggs[i] != "count") { continue; }
+    for (cudf::size_type j = 0; j < num_columns(); ++j) {
+      results[i].push_back(count_column(get_column(j)));
+    }
+  }
+
+  return results;
+}
+
+Napi::Value Table::reduce_all(Napi::CallbackInfo const& info) {
+  CallbackArgs args{info};
+  std::vector<std::string> aggs       = args[0];
+  rmm::mr::device_memory_resource* mr = args[3];
+  std::vector<double> quantiles{};
+  auto interpolation = cudf::interpolation::LINEAR;
+  if (args[1].IsArray()) { quantiles = args[1].operator std::vector<double>(); }
+  if (!args[2].IsUndefined()) { interpolation = args[2]; }
+  // Everything is launched before the first result is copied back to the host, so only that
+  // first copy waits on the device.
+  auto scalars  = reduce_all(aggs, quantiles, interpolation, mr);
+  auto to_array = [&](std::vector<ObjectUnwrap<Scalar>> const& row) {
+    auto values = Napi::Array::New(info.Env(), row.size());
+    for (std::size_t j = 0; j < row.size(); ++j) { values.Set(j, row[j]->get_value()); }
+    return values;
+  };
+  auto result = Napi::Object::New(info.Env());
+  for (std::size_t i = 0; i < aggs.size(); ++i) { result.Set(aggs[i], to_array(scalars[i])); }
+  if (!quantiles.empty()) {
+    auto values = Napi::Array::New(info.Env(), quantiles.size());
+    for (std::size_t k = 0; k < quantiles.size(); ++k) {
+      values.Set(k, to_array(scalars[aggs.size() + k]));
+    }
+    result.Set("quantiles", values);
+  }
+  return result;
+}
+
+}  // namespace nv
@@ -0,0 +1,186 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <node_cudf/column.hpp>
+#include <node_cudf/table.hpp>
+#include <node_cudf/utilities/error.hpp>
+#include <node_cudf/utilities/napi_to_cpp.hpp>
+#include <node_cudf/utilities/stream.hpp>
+
+#include <node_rmm/utilities/napi_to_cpp.hpp>
+
+#include <nv_node/utilities/args.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/binaryop.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/sequence.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/unary.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+namespace nv {
+
+namespace {
+
+std::unique_ptr<cudf::table> gather_rows(cudf::table_view const& table,
+                                         cudf::column_view const& gather_map,
+                                         rmm::mr::device_memory_resource* mr) {
+  return cudf::detail::gather(table,
+                              gather_map,
+                              cudf::out_of_bounds_policy::DONT_CHECK,
+                              cudf::detail::negative_index_policy::NOT_ALLOWED,
+                              get_current_stream(),
+                              mr);
+}
+
+// Rows sampled from the first key column to pick the top-k candidate threshold
+constexpr cudf::size_type top_k_sample_size = 4096;
+
+// Returns a mask of the rows whose first key sorts no later than a threshold sampled from it,
+// or nullptr if the first key can't be filtered that way. Every row of the top `k` passes the
+// mask whenever at least `k` rows do.
+std::unique_ptr<cudf::column> top_k_candidates(cudf::table_view const& keys,
+                                               cudf::size_type k,
+                                               std::vector<cudf::order> const& column_order) {
+  auto const n    = keys.num_rows();
+  auto const key  = keys.column(0);
+  auto const type = key.type();
+  if (key.null_count() > 0 || !(cudf::is_numeric(type) || cudf::is_timestamp(type))) {
+    return nullptr;
+  }
+  if (n <= top_k_sample_size || static_cast<int64_t>(k) * 16 > n) { return nullptr; }
+
+  auto const stream    = get_current_stream();
+  auto const ascending = column_order.empty() || column_order[0] == cudf::order::ASCENDING;
+
+  // Sort an evenly strided sample of the first key, and take the value twice as far into it as
+  // the k-th row is expected to be, so the threshold usually admits at least k rows
+  auto const m      = top_k_sample_size;
+  auto const start  = cudf::numeric_scalar<cudf::size_type>(0);
+  auto const stride = cudf::numeric_scalar<cudf::size_type>(n / m);
+  auto const map    = cudf::detail::sequence(m, start, stride, stream);
+  auto const sample = cudf::detail::sort(
+    gather_rows(cudf::table_view{{key}}, *map, rmm::mr::get_current_device_resource())->view(),
+    {ascending ? cudf::order::ASCENDING : cudf::order::DESCENDING},
+    {},
+    stream);
+  auto const rank =
+    std::min(m - 1, static_cast<cudf::size_type>(std::ceil(2.0 * k * m / n)));
+  auto const threshold = cudf::detail::get_element(sample->get_column(0), rank, stream);
+
+  auto const bool8 = cudf::data_type{cudf::type_id::BOOL8};
+  auto const op    = ascending ? cudf::binary_operator::LESS_EQUAL  //
+                               : cudf::binary_operator::GREATER_EQUAL;
+  auto mask        = cudf::detail::binary_operation(key, *threshold, op, bool8, stream);
+  // NaNs sort after every other value, so they come first in descending order
+  if (!ascending && cudf::is_floating_point(type)) {
+    auto const nans = cudf::detail::is_nan(key, stream);
+    mask            = cudf::detail::binary_operation(
+      *mask, *nans, cudf::binary_operator::LOGICAL_OR, bool8, stream);
+  }
+  return mask;
+}
+
+}  // namespace
+
+ObjectUnwrap<Table> Table::sort_by_key(Table const& keys,
+                                       std::vector<cudf::order> const& column_order,
+                                       std::vector<cudf::null_order> const& null_precedence,
+                                       rmm::mr::device_memory_resource* mr) const {
+  return Table::New(cudf::detail::sort_by_key(
+    *this, keys, column_order, null_precedence, get_current_stream(), mr));
+}
+
+ObjectUnwrap<Table> Table::stable_sort_by_key(Table const& keys,
+                                              std::vector<cudf::order> const& column_order,
+                                              std::vector<cudf::null_order> const& null_precedence,
+                                              rmm::mr::device_memory_resource* mr) const {
+  // libcudf has no stable_sort_by_key, so gather by the stable order without leaving C++
+  auto order = cudf::detail::stable_sorted_order(
+    keys, column_order, null_precedence, get_current_stream());
+  return Table::New(gather_rows(*this, *order, mr));
+}
+
+ObjectUnwrap<Table> Table::top_k(Table const& keys,
+                                 cudf::size_type k,
+                                 std::vector<cudf::order> const& column_order,
+                                 std::vector<cudf::null_order> const& null_precedence,
+                                 rmm::mr::device_memory_resource* mr) const {
+  auto const stream   = get_current_stream();
+  auto const rows     = this->view();
+  auto const key_view = keys.view();
+  k                   = std::max(0, std::min(k, rows.num_rows()));
+
+  // Filter both tables down to the candidate rows, and only sort those. The candidates keep
+  // their original order, so stable-sorting them selects the same rows as a full stable sort.
+  if (k > 0 && key_view.num_columns() > 0) {
+    auto const mask = top_k_candidates(key_view, k, column_order);
+    if (mask != nullptr) {
+      std::vector<cudf::column_view> columns(rows.begin(), rows.end());
+      columns.insert(columns.end(), key_view.begin(), key_view.end());
+      auto const candidates =
+        cudf::detail::apply_boolean_mask(cudf::table_view{columns}, *mask, stream);
+      if (candidates->num_rows() >= k) {
+        std::vector<cudf::size_type> row_cols(rows.num_columns());
+        std::vector<cudf::size_type> key_cols(key_view.num_columns());
+        std::iota(row_cols.begin(), row_cols.end(), 0);
+        std::iota(key_cols.begin(), key_cols.end(), rows.num_columns());
+        auto const view  = candidates->view();
+        auto const order = cudf::detail::stable_sorted_order(
+          view.select(key_cols), column_order, null_precedence, stream);
+        auto const head = cudf::slice(*order, {0, k}).front();
+        return Table::New(gather_rows(view.select(row_cols), head, mr));
+      }
+    }
+  }
+
+  // The first key can't be filtered, or the sampled threshold admitted fewer than k rows
+  auto order = cudf::detail::stable_sorted_order(key_view, column_order, null_precedence, stream);
+  auto head  = cudf::slice(*order, {0, k}).front();
+  return Table::New(gather_rows(rows, head, mr));
+}
+
+Napi::Value Table::sort_by_key(Napi::CallbackInfo const& info) {
+  CallbackArgs args{info};
+  NODE_CUDF_EXPECT(Table::is_instance(args[0]), "sortByKey expects a keys Table", info.Env());
+  return sort_by_key(*Table::Unwrap(args[0].ToObject()), args[1], args[2], args[3])->Value();
+}
+
+Napi::Value Table::stable_sort_by_key(Napi::CallbackInfo const& info) {
+  CallbackArgs args{info};
+  NODE_CUDF_EXPECT(Table::is_instance(args[0]), "stableSortByKey expects a keys Table", info.Env());
+  return stable_sort_by_key(*Table::Unwrap(args[0].ToObject()), args[1], args[2], args[3])
+    ->Value();
+}
+
+Napi::Value Table::top_k(Napi::CallbackInfo const& info) {
+  CallbackArgs args{info};
+  NODE_CUDF_EXPECT(Table::is_instance(args[0]), "topK expects a keys Table", info.Env());
+  return top_k(*Table::Unwrap(args[0].ToObject()), args[1], args[2], args[3], args[4])->Value();
+}
+
+}  // namespace nv
@@ -15,11 +15,15 @@
 #include <node_cudf/column.hpp>
 #include <node_cudf/table.hpp>
 #include <node_cudf/utilities/napi_to_cpp.hpp>
+#include <node_cudf/utilities/stream.hpp>
 #include <nv_node/utilities/args.hpp>
 #include <nv_node/utilities/napi_to_cpp.hpp>
 
+#include <node_rmm/utilities/napi_to_cpp.hpp>
+
 #include "cudf/types.hpp"
 
+#include <cudf/detail/stream_compaction.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table_view.hpp>
 
@@ -30,13 +34,14 @@ namespace nv {
 
 ObjectUnwrap<Table> Table::apply_boolean_mask(Column const& boolean_mask,
                                               rmm::mr::device_memory_resource* mr) const {
-  return Table::New(cudf::apply_boolean_mask(cudf::table_view{{*this}}, boolean_mask, mr));
+  return Table::New(cudf::detail::apply_boolean_mask(
+    cudf::table_view{{*this}}, boolean_mask, get_current_stream(), mr));
 }
 
 ObjectUnwrap<Table> Table::drop_nulls(std::vector<cudf::size_type> keys,
                                       cudf::size_type threshold,
                                       rmm::mr::device_memory_resource* mr) const {
-  return Table::New(cudf::drop_nulls(*this, keys, threshold, mr));
+  return Table::New(cudf::detail::drop_nulls(*this, keys, threshold, get_current_stream(), mr));
 }
 
 Napi::Value Table::drop_nulls(Napi::CallbackInfo const& info) {
@@ -47,7 +52,7 @@ Napi::Value Table::drop_nulls(Napi::CallbackInfo const& info) {
 ObjectUnwrap<Table> Table::drop_nans(std::vector<cudf::size_type> keys,
                                      cudf::size_type threshold,
                                      rmm::mr::device_memory_resource* mr) const {
-  return Table::New(cudf::drop_nans(*this, keys, threshold, mr));
+  return Table::New(cudf::detail::drop_nans(*this, keys, threshold, get_current_stream(), mr));
 }
 
 Napi::Value Table::drop_nans(Napi::CallbackInfo const& info) {
@@ -55,4 +60,29 @@ Napi::Value Table::drop_nans(Napi::CallbackInfo const& info) {
   return drop_nans(args[0], args[1], args[2])->Value();
 }
 
+ObjectUnwrap<Table> Table::drop_duplicates(std::vector<cudf::size_type> const& keys,
+                                           cudf::duplicate_keep_option keep,
+                                           cudf::null_equality nulls_equal,
+                                           rmm::mr::device_memory_resource* mr) const {
+  return Table::New(
+    cudf::detail::drop_duplicates(*this, keys, keep, nulls_equal, get_current_stream(), mr));
+}
+
+Napi::Value Table::drop_duplicates(Napi::CallbackInfo const& info) {
+  CallbackArgs args{info};
+  return drop_duplicates(args[0], args[1], args[2], args[3])->Value();
+}
+
+cudf::size_type Table::distinct_count(cudf::null_equality nulls_equal) const {
+  return cudf::detail::distinct_count(*this, nulls_equal, get_current_stream());
+}
+
+Napi::Value Table::distinct_count(Napi::CallbackInfo const& info) {
+  CallbackArgs args{info};
+  auto const nulls_equal = args.Length() > 0 && !args[0].IsUndefined()
+                             ? args[0].operator cudf::null_equality()
+                             : cudf::null_equality::EQUAL;
+  return Napi::Number::New(info.Env(), distinct_count(nulls_equal));
+}
+
 }  // namespace nv
@@ -0,0 +1,306 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <node_cudf/column.hpp>
+#include <node_cudf/table.hpp>
+#include <node_cudf/table_builder.hpp>
+#include <node_cudf/utilities/dtypes.hpp>
+#include <node_cudf/utilities/error.hpp>
+#include <node_cudf/utilities/stream.hpp>
+
+#include <node_cuda/utilities/error.hpp>
+
+#include <node_rmm/device_buffer.hpp>
+#include <node_rmm/memory_resource.hpp>
+
+#include <nv_node/utilities/args.hpp>
+#include <nv_node/utilities/span.hpp>
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <cuda_runtime_api.h>
+#include <napi.h>
+
+#include <algorithm>
+
+namespace nv {
+
+//
+// Public API
+//
+
+Napi::FunctionReference TableBuilder::constructor;
+
+Napi::Object TableBuilder::Init(Napi::Env env, Napi::Object exports) {
+  Napi::Function ctor = DefineClass(env,
+                                    "TableBuilder",
+                                    {
+                                      InstanceAccessor<&TableBuilder::num_rows>("numRows"),
+                                      InstanceAccessor<&TableBuilder::num_columns>("numColumns"),
+                                      InstanceAccessor<&TableBuilder::capacity>("capacity"),
+                                      InstanceMethod<&TableBuilder::reserve>("reserve"),
+                                      InstanceMethod<&TableBuilder::append>("append"),
+                                      InstanceMethod<&TableBuilder::snapshot>("snapshot"),
+                                    });
+
+  TableBuilder::constructor = Napi::Persistent(ctor);
+  TableBuilder::constructor.SuppressDestruct();
+  exports.Set("TableBuilder", ctor);
+
+  return exports;
+}
+
+TableBuilder::TableBuilder(CallbackArgs const& args) : Napi::ObjectWrap<TableBuilder>(args) {
+  auto env = args.Env();
+
+  NODE_CUDF_EXPECT(args.IsConstructCall(), "TableBuilder constructor requires 'new'", env);
+  NODE_CUDF_EXPECT(
+    args[0].IsArray(), "TableBuilder constructor expects an Array of DataTypes", env);
+
+  auto types = args[0].As<Napi::Array>();
+  for (auto i = 0u; i < types.Length(); ++i) {
+    NODE_CUDF_EXPECT(cudf::is_fixed_width(arrow_to_cudf_type(types.Get(i).ToObject())),
+                     "TableBuilder only supports fixed-width column types",
+                     env);
+  }
+
+  auto mr = MemoryResource::is_instance(args[2])
+              ? ObjectUnwrap<MemoryResource>(args[2].ToObject())
+              : MemoryResource::Cuda();
+
+  auto data  = Napi::Array::New(env, types.Length());
+  auto masks = Napi::Array::New(env, types.Length());
+  for (auto i = 0u; i < types.Length(); ++i) {
+    auto const column_data = DeviceBuffer::New(mr, get_current_stream());
+    auto const column_mask = DeviceBuffer::New(mr, get_current_stream());
+    data.Set(i, column_data->Value());
+    masks.Set(i, column_mask->Value());
+    shares_.push_back(column_data->share());
+    shares_.push_back(column_mask->share());
+  }
+
+  types_ = Napi::Persistent(types);
+  data_  = Napi::Persistent(data);
+  masks_ = Napi::Persistent(masks);
+  mr_    = Napi::Persistent(mr.object());
+
+  if (args.Length() > 1 && args[1].IsNumber()) { reserve(args[1]); }
+}
+
+void TableBuilder::Finalize(Napi::Env env) {
+  shares_.clear();
+  types_.Reset();
+  data_.Reset();
+  masks_.Reset();
+  mr_.Reset();
+}
+
+void TableBuilder::reserve(cudf::size_type num_rows) {
+  if (num_rows <= capacity_) { return; }
+  capacity_ = std::max(num_rows, 2 * capacity_);
+  for (cudf::size_type i = 0; i < num_columns(); ++i) {
+    auto& data = this->data(i).buffer();
+    auto& mask = this->mask(i).buffer();
+    // Reallocate to the new capacity, then shrink the size back to the committed rows
+    data.resize(capacity_ * cudf::size_of(type(i)), data.stream());
+    data.resize(num_rows_ * cudf::size_of(type(i)), data.stream());
+    if (mask.size() > 0) {
+      mask.resize(cudf::bitmask_allocation_size_bytes(capacity_), mask.stream());
+      mask.resize(cudf::bitmask_allocation_size_bytes(num_rows_), mask.stream());
+    }
+  }
+}
+
+cudf::size_type TableBuilder::append(Napi::Array const& columns) {
+  auto env = Env();
+
+  NODE_CUDF_EXPECT(static_cast<cudf::size_type>(columns.Length()) == num_columns(),
+                   "TableBuilder.append expects one value per column",
+                   env);
+
+  // Validate the batch and compute its number of rows before modifying any column
+  cudf::size_type batch_rows{-1};
+  for (cudf::size_type i = 0; i < num_columns(); ++i) {
+    auto const value = columns.Get(i);
+    auto const width = cudf::size_of(type(i));
+    cudf::size_type rows{};
+    if (Column::is_instance(value)) {
+      auto const& column = *Column::Unwrap(value.ToObject());
+      NODE_CUDF_EXPECT(column.type() == type(i), "TableBuilder.append column type mismatch", env);
+      rows = column.size();
+    } else {
+      Span<char> const span = NapiToCPP(value);
+      NODE_CUDF_EXPECT(span.size() % width == 0,
+                       "TableBuilder.append memory size must be a multiple of the element size",
+                       env);
+      rows = span.size() / width;
+    }
+    NODE_CUDF_EXPECT(batch_rows < 0 || rows == batch_rows,
+                     "TableBuilder.append expects columns of equal length",
+                     env);
+    batch_rows = rows;
+  }
+
+  if (batch_rows <= 0) { return num_rows_; }
+
+  auto const stream   = get_current_stream();
+  auto const new_rows = num_rows_ + batch_rows;
+
+  reserve(new_rows);
+
+  for (cudf::size_type i = 0; i < num_columns(); ++i) {
+    auto const value = columns.Get(i);
+    auto const width = cudf::size_of(type(i));
+    auto& data       = this->data(i).buffer();
+
+    // Within capacity, so this doesn't reallocate
+    data.resize(new_rows * width, data.stream());
+    auto dst = static_cast<char*>(data.data()) + num_rows_ * width;
+
+    if (Column::is_instance(value)) {
+      auto const view = Column::Unwrap(value.ToObject())->view();
+      auto const src  = static_cast<char const*>(view.head()) + view.offset() * width;
+      NODE_CUDA_TRY(
+        cudaMemcpyAsync(dst, src, batch_rows * width, cudaMemcpyDefault, stream.value()), env);
+      append_mask(i, view);
+    } else {
+      Span<char> const span = NapiToCPP(value);
+      NODE_CUDA_TRY(cudaMemcpyAsync(dst,
+                                    static_cast<void*>(span),
+                                    batch_rows * width,
+                                    cudaMemcpyDefault,
+                                    stream.value()),
+                    env);
+      append_mask(i, cudf::column_view{type(i), batch_rows, dst});
+    }
+  }
+
+  // Host memory may be reused or freed by the caller as soon as append returns
+  NODE_CUDA_TRY(cudaStreamSynchronize(stream.value()), env);
+
+  num_rows_ = new_rows;
+  return num_rows_;
+}
+
+Napi::Object TableBuilder::snapshot() const {
+  auto env     = Env();
+  auto columns = Napi::Array::New(env, num_columns());
+  for (cudf::size_type i = 0; i < num_columns(); ++i) {
+    auto props = Napi::Object::New(env);
+    props.Set("type", types_.Value().Get(i));
+    props.Set("offset", 0);
+    props.Set("length", num_rows_);
+    props.Set("data", data_.Value().Get(i));
+    if (mask(i).size() > 0) { props.Set("nullMask", masks_.Value().Get(i)); }
+    columns.Set(i, Column::New(props)->Value());
+  }
+  return Table::New(columns);
+}
+
+//
+// Private API
+//
+
+cudf::data_type TableBuilder::type(cudf::size_type column_index) const {
+  return arrow_to_cudf_type(types_.Value().Get(column_index).ToObject());
+}
+
+DeviceBuffer& TableBuilder::data(cudf::size_type column_index) const {
+  return *DeviceBuffer::Unwrap(data_.Value().Get(column_index).ToObject());
+}
+
+DeviceBuffer& TableBuilder::mask(cudf::size_type column_index) const {
+  return *DeviceBuffer::Unwrap(masks_.Value().Get(column_index).ToObject());
+}
+
+void TableBuilder::append_mask(cudf::size_type column_index, cudf::column_view const& batch) {
+  auto& mask = this->mask(column_index).buffer();
+  // Columns without nulls so far stay non-nullable
+  if (mask.size() == 0 && !batch.has_nulls()) { return; }
+
+  auto const stream   = get_current_stream();
+  auto const new_rows = num_rows_ + batch.size();
+  if (mask.size() == 0) {
+    // First batch with nulls, allocate the mask's capacity and mark every committed row valid
+    mask.resize(cudf::bitmask_allocation_size_bytes(capacity_), mask.stream());
+    cudf::detail::set_null_mask(
+      static_cast<cudf::bitmask_type*>(mask.data()), 0, num_rows_, true, stream);
+  }
+  // Within capacity, so this doesn't reallocate
+  mask.resize(cudf::bitmask_allocation_size_bytes(new_rows), mask.stream());
+
+  auto const bits = static_cast<cudf::bitmask_type*>(mask.data());
+  if (!batch.has_nulls()) {
+    cudf::detail::set_null_mask(bits, num_rows_, new_rows, true, stream);
+    return;
+  }
+
+  // Concatenate the committed bits of the last partially-filled word with the batch's bits, then
+  // overwrite the mask from that word onward. The committed bits are rewritten unchanged.
+  auto const word_bits =
+    static_cast<cudf::size_type>(cudf::detail::size_in_bits<cudf::bitmask_type>());
+  auto const tail_begin = num_rows_ - (num_rows_ % word_bits);
+  auto const tail       = cudf::column_view{type(column_index),
+                                      num_rows_ - tail_begin,
+                                      data(column_index).data(),
+                                      bits,
+                                      cudf::UNKNOWN_NULL_COUNT,
+                                      tail_begin};
+  auto const merged = cudf::concatenate_masks(std::vector<cudf::column_view>{tail, batch});
+  NODE_CUDA_TRY(cudaMemcpyAsync(bits + tail_begin / word_bits,
+                                merged.data(),
+                                cudf::num_bitmask_words(new_rows - tail_begin) *
+                                  sizeof(cudf::bitmask_type),
+                                cudaMemcpyDefault,
+                                stream.value()),
+                Env());
+  // Wait for the copy before `merged` is freed
+  NODE_CUDA_TRY(cudaStreamSynchronize(stream.value()), Env());
+}
+
+Napi::Value TableBuilder::num_rows(Napi::CallbackInfo const& info) {
+  return Napi::Number::New(info.Env(), num_rows());
+}
+
+Napi::Value TableBuilder::num_columns(Napi::CallbackInfo const& info) {
+  return Napi::Number::New(info.Env(), num_columns());
+}
+
+Napi::Value TableBuilder::capacity(Napi::CallbackInfo const& info) {
+  return Napi::Number::New(info.Env(), capacity());
+}
+
+Napi::Value TableBuilder::reserve(Napi::CallbackInfo const& info) {
+  CallbackArgs args{info};
+  reserve(args[0]);
+  return info.Env().Undefined();
+}
+
+Napi::Value TableBuilder::append(Napi::CallbackInfo const& info) {
+  CallbackArgs args{info};
+  NODE_CUDF_EXPECT(args[0].IsArray(), "TableBuilder.append expects an Array", info.Env());
+  return Napi::Number::New(info.Env(), append(args[0].As<Napi::Array>()));
+}
+
+Napi::Value TableBuilder::snapshot(Napi::CallbackInfo const& info) { return snapshot(); }
+
+}  // namespace nv
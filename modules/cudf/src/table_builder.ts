@@ -0,0 +1,148 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import {MemoryData} from '@nvidia/cuda';
+import {MemoryResource} from '@nvidia/rmm';
+import * as arrow from 'apache-arrow';
+
+import CUDF from './addon';
+import {Column} from './column';
+import {ColumnAccessor} from './column_accessor';
+import {DataFrame} from './data_frame';
+import {Series} from './series';
+import {Table} from './table';
+import {DataType} from './types/dtypes';
+import {ColumnsMap, TypeMap} from './types/mappings';
+
+interface TableBuilderConstructor {
+  readonly prototype: TableBuilder;
+  /**
+   * Create a builder of fixed-width columns.
+   *
+   * @param types The type of each column.
+   * @param capacity The optional number of rows to allocate up front.
+   * @param memoryResource The optional MemoryResource used to allocate the columns' device memory.
+   */
+  new(types: DataType[], capacity?: number, memoryResource?: MemoryResource): TableBuilder;
+}
+
+/**
+ * An append-only builder of fixed-width columns for streaming ingestion. Each column's device
+ * memory grows geometrically, so appending many small batches costs amortized O(rows appended)
+ * rather than re-concatenating the whole Table for each batch.
+ */
+export interface TableBuilder {
+  /** The number of rows appended so far. */
+  readonly numRows: number;
+  /** The number of columns. */
+  readonly numColumns: number;
+  /** The number of rows that can be appended without reallocating. */
+  readonly capacity: number;
+
+  /**
+   * Grow each column's capacity to at least `numRows` rows.
+   *
+   * @param numRows The number of rows to reserve space for.
+   */
+  reserve(numRows: number): void;
+
+  /**
+   * Append a batch of rows.
+   *
+   * @param columns One value per column: a Column of the column's type, or host or device memory
+   *   (e.g. a TypedArray) holding densely packed elements of the column's type.
+   * @returns The number of rows after the append.
+   */
+  append(columns: (Column|MemoryData|ArrayBufferView)[]): number;
+
+  /**
+   * Returns a Table of the rows appended so far. The Table shares the builder's device memory
+   * rather than copying it, and is not affected by later appends.
+   */
+  snapshot(): Table;
+}
+
+// eslint-disable-next-line @typescript-eslint/no-redeclare
+export const TableBuilder: TableBuilderConstructor = CUDF.TableBuilder;
+
+export type DataFrameBatch<T extends TypeMap> = {
+  [P in keyof T]: Series<T[P]>|Column<T[P]>|arrow.Vector<T[P]>|MemoryData|ArrayBufferView
+};
+
+/**
+ * Builds a DataFrame of fixed-width columns from batches of rows, such as JS TypedArrays or
+ * Arrow RecordBatches.
+ *
+ * @example
+ * ```typescript
+ * import {DataFrameBuilder, Float64, Int32} from '@nvidia/cudf';
+ *
+ * const builder = new DataFrameBuilder({id: new Int32, value: new Float64});
+ * builder.append({id: new Int32Array([1, 2]), value: new Float64Array([0.5, 1.5])});
+ * const df = builder.snapshot();
+ * ```
+ */
+export class DataFrameBuilder<T extends TypeMap = any> {
+  private _names: (keyof T)[];
+  private _builder: TableBuilder;
+
+  /**
+   * @param types The name and type of each column.
+   * @param capacity The optional number of rows to allocate up front.
+   * @param memoryResource The optional MemoryResource used to allocate the columns' device memory.
+   */
+  constructor(types: T, capacity?: number, memoryResource?: MemoryResource) {
+    this._names   = Object.keys(types);
+    this._builder =
+      new TableBuilder(this._names.map((name) => types[name]), capacity, memoryResource);
+  }
+
+  /** The number of rows appended so far. */
+  get numRows() { return this._builder.numRows; }
+
+  /** The number of rows that can be appended without reallocating. */
+  get capacity() { return this._builder.capacity; }
+
+  /**
+   * Append a batch of rows.
+   *
+   * @param batch An Arrow RecordBatch or Table with a field for each column, or a map from
+   *   column names to Series, Columns, Arrow Vectors, or host or device memory.
+   * @returns The number of rows after the append.
+   */
+  append(batch: arrow.RecordBatch|arrow.Table|DataFrameBatch<T>) {
+    const columns = this._names.map((name) => {
+      const value = (batch instanceof arrow.RecordBatch || batch instanceof arrow.Table)
+                      ? batch.getChildAt(batch.schema.fields.findIndex((f) => f.name === name))
+                      : (batch as DataFrameBatch<T>)[name];
+      if (value === null || value === undefined) {
+        throw new Error(`DataFrameBuilder batch is missing column '${String(name)}'`);
+      }
+      if (value instanceof Series) { return value._col; }
+      if (value instanceof arrow.Vector) { return Series.new(value)._col; }
+      return value;
+    });
+    return this._builder.append(columns as (Column|MemoryData|ArrayBufferView)[]);
+  }
+
+  /**
+   * Returns a DataFrame of the rows appended so far. The DataFrame shares the builder's device
+   * memory rather than copying it, and is not affected by later appends.
+   */
+  snapshot() {
+    const table = this._builder.snapshot();
+    return new DataFrame(new ColumnAccessor(this._names.reduce(
+      (map, name, i) => ({...map, [name]: table.getColumnByIndex(i)}), {} as ColumnsMap<T>)));
+  }
+}
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+import {CSVSchemaCache} from '../csv_schema_cache';
 import {
   Bool8,
   Float32,
@@ -129,6 +130,11 @@ export interface ReadCSVOptionsCommon<T extends CSVTypeMap = any> {
   datetimeColumns?: string[];
   /** Names of columns to read; empty/null is all columns */
   columnsToReturn?: string[];
+  /**
+   * A cache of inferred schemas. If `dataTypes` is not given, the cached schema for the sources is
+   * used instead of inferring types, and schemas inferred by full reads are added to the cache.
+   */
+  schemaCache?: CSVSchemaCache;
 }
 
 export interface ReadCSVFileOptions<T extends CSVTypeMap = any> extends ReadCSVOptionsCommon<T> {
@@ -19,7 +19,7 @@ export type FloatingPoint = Float32|Float64;
 export type IndexType     = Int8|Int16|Int32|Uint8|Uint16|Uint32;
 export type Integral      = IndexType|Int64|Uint64;
 export type Numeric       = Integral|FloatingPoint|Bool8;
-export type DataType      = Numeric|Utf8String|List|Struct;
+export type DataType      = Numeric|Utf8String|List|Struct|Dictionary;
 
 export interface Int8 extends arrow.Int8 {
   scalarType: number;
@@ -114,3 +114,10 @@ export interface Struct<T extends TypeMap = any> extends arrow.Struct<T> {
   scalarType: {[P in keyof T]: T[P]['scalarType']};
 }
 export class Struct<T extends TypeMap = any> extends arrow.Struct<T> {}
+
+export interface Dictionary<T extends DataType = any, TKey extends IndexType = Uint32> extends
+  arrow.Dictionary<T, TKey> {
+  scalarType: T['scalarType'];
+}
+export class Dictionary<T extends DataType = any, TKey extends IndexType = Uint32> extends
+  arrow.Dictionary<T, TKey> {}
@@ -19,8 +19,10 @@ import {Column} from '../column';
 import {
   Bool8,
   DataType,
+  Dictionary,
   Float32,
   Float64,
+  IndexType,
   Int16,
   Int32,
   Int64,
@@ -44,6 +46,22 @@ export enum Interpolation
   nearest    ///< i or j, whichever is nearest
 }
 
+/**
+ * The aggregations that can be computed over a rolling window.
+ *
+ * `count` excludes nulls, `count_all` includes them.
+ */
+export type RollingAggregation =
+  'sum'|'min'|'max'|'mean'|'count'|'count_all'|'argmin'|'argmax'|'row_number';
+
+/**
+ * The reductions that can be computed over every column of a Table with `Table.reduceAll`.
+ *
+ * `count` is the number of non-null values.
+ */
+export type Reduction = 'count'|'min'|'max'|'sum'|'product'|'sum_of_squares'|'mean'|'median'|
+  'var'|'std'|'nunique'|'any'|'all';
+
 export type TypeMap = {
   [key: string]: DataType
 };
@@ -129,7 +147,7 @@ export type ArrowToCUDFType<T extends arrow.DataType> =
 //  T extends arrow.FixedSizeBinary ? never :
 //  T extends arrow.FixedSizeList ? never :
 //  T extends arrow.Map_ ? never :
-//  T extends arrow.Dictionary ? never :
+ T extends arrow.Dictionary ? T extends Dictionary ? T : Dictionary<ArrowToCUDFType<T['valueType']>> :
  never;
 // clang-format on
 
@@ -189,7 +207,9 @@ export const arrowToCUDFType = (() => {
     }
     // public visitDenseUnion           <T extends arrow.DenseUnion>(type: T) { return new DenseUnion(type); }
     // public visitSparseUnion          <T extends arrow.SparseUnion>(type: T) { return new SparseUnion(type); }
-    // public visitDictionary           <T extends arrow.Dictionary>(type: T) { return new Dictionary(type); }
+    public visitDictionary           <T extends arrow.Dictionary>(type: T) {
+      return new Dictionary(this.visit(type.dictionary), this.visit(type.indices) as IndexType);
+    }
     // public visitIntervalDayTime      <T extends arrow.IntervalDayTime>(type: T) { return new IntervalDayTime; }
     // public visitIntervalYearMonth    <T extends arrow.IntervalYearMonth>(type: T) { return new IntervalYearMonth; }
     // public visitFixedSizeList        <T extends arrow.FixedSizeList>(type: T) { return new FixedSizeList(type); }
@@ -0,0 +1,38 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+export interface ReadParquetOptionsCommon {
+  /** Names of columns to read; empty/null is all columns */
+  columns?: string[];
+  /** Rows to skip from the start */
+  skipRows?: number;
+  /** Rows to read; -1 is all */
+  numRows?: number;
+  /** Indices of the row groups to read from each source; overrides `skipRows` and `numRows` */
+  rowGroups?: number[][];
+  /** Whether to read the index columns described by pandas metadata */
+  usePandasMetadata?: boolean;
+}
+
+export interface ReadParquetFileOptions extends ReadParquetOptionsCommon {
+  sourceType: 'files';
+  sources: string[];
+}
+
+export interface ReadParquetBufferOptions extends ReadParquetOptionsCommon {
+  sourceType: 'buffers';
+  sources: (Uint8Array|Buffer)[];
+}
+
+export type ReadParquetOptions = ReadParquetFileOptions|ReadParquetBufferOptions;
@@ -63,6 +63,7 @@ cudf::data_type arrow_to_cudf_type(Napi::Object const& type) {
   using cudf::data_type;
   using cudf::type_id;
   switch (type.Get("typeId").ToNumber().Int32Value()) {
+    case -1 /*Arrow.Dictionary      */: return data_type{type_id::DICTIONARY32};
     case 0 /*Arrow.NONE            */: return data_type{type_id::EMPTY};
     case 1 /*Arrow.Null            */: return data_type{type_id::EMPTY};
     case 2 /*Arrow.Int             */: {
@@ -193,7 +194,18 @@ Napi::Object column_to_arrow_type(Napi::Env const& env, cudf::column_view const&
     // case cudf::type_id::DURATION_MILLISECONDS: // TODO
     // case cudf::type_id::DURATION_MICROSECONDS: // TODO
     // case cudf::type_id::DURATION_NANOSECONDS: // TODO
-    // case cudf::type_id::DICTIONARY32: // TODO
+    case cudf::type_id::DICTIONARY32: {
+      // Dictionary columns have two children: the indices, and the sorted keys
+      arrow_type.Set("typeId", -1);
+      arrow_type.Set("indices",
+                     column.num_children() > 0
+                       ? column_to_arrow_type(env, column.child(0))
+                       : cudf_to_arrow_type(env, cudf::data_type{cudf::type_id::UINT32}));
+      if (column.num_children() > 1) {
+        arrow_type.Set("dictionary", column_to_arrow_type(env, column.child(1)));
+      }
+      break;
+    }
     case cudf::type_id::STRING: {
       arrow_type.Set("typeId", 5);
       break;
@@ -0,0 +1,47 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <node_cudf/utilities/stream.hpp>
+
+#include <node_cuda/utilities/cpp_to_napi.hpp>
+#include <node_cuda/utilities/napi_to_cpp.hpp>
+
+namespace nv {
+
+namespace {
+
+// Only touched from the JS thread
+rmm::cuda_stream_view current_stream_{rmm::cuda_stream_default};
+
+}  // namespace
+
+rmm::cuda_stream_view get_current_stream() { return current_stream_; }
+
+rmm::cuda_stream_view set_current_stream(rmm::cuda_stream_view stream) {
+  auto prev       = current_stream_;
+  current_stream_ = stream;
+  return prev;
+}
+
+Napi::Value current_stream(CallbackArgs const& args) {
+  return CPPToNapi(args.Env())(get_current_stream().value());
+}
+
+Napi::Value exchange_current_stream(CallbackArgs const& args) {
+  cudaStream_t stream = args[0];
+  return CPPToNapi(args.Env())(set_current_stream(stream).value());
+}
+
+}  // namespace nv
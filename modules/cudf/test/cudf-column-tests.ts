@@ -13,8 +13,21 @@
 // limitations under the License.
 
 import {Float32Buffer, Int32Buffer, setDefaultAllocator, Uint8Buffer} from '@nvidia/cuda';
-import {Bool8, Column, Float32, Int32, Series, Uint8, Utf8String} from '@nvidia/cudf';
-import {CudaMemoryResource, DeviceBuffer} from '@nvidia/rmm';
+import {
+  Bool8,
+  Column,
+  Float32,
+  getCurrentStream,
+  getSpillStats,
+  Int32,
+  Series,
+  setSpillOptions,
+  spillOnAllocationFailure,
+  Uint8,
+  Utf8String,
+  withStream
+} from '@nvidia/cudf';
+import {CudaMemoryResource, DeviceBuffer, LimitingResourceAdaptor} from '@nvidia/rmm';
 import {BoolVector} from 'apache-arrow';
 
 const mr = new CudaMemoryResource();
@@ -143,3 +156,103 @@ test('Column.nans_to_nulls', () => {
   const expected = [1, 3, null, 4, 2, 0];
   expect([...Series.new(result).toArrow()]).toEqual(expected);
 });
+
+test('Column.stats caches reductions until mutation', () => {
+  const col = new Column({type: new Int32, data: new Int32Buffer([3, 1, 2, 3, 0])});
+
+  expect(col.stats()).toEqual({nullCount: 0});
+  expect(col.minmax()).toEqual([0, 3]);
+  expect(col.nunique()).toBe(4);
+  expect(col.stats()).toEqual({nullCount: 0, min: 0, max: 3, distinctCount: 4});
+
+  col.setNullMask(new Uint8Buffer(64).fill(0), 5);
+  expect(col.stats()).toEqual({nullCount: 5});
+});
+
+test('Column.describe', () => {
+  const col = new Column({type: new Int32, data: new Int32Buffer([0, 1, 1, 2, 5])});
+
+  expect(col.describe())
+    .toEqual({nullCount: 0, min: 0, max: 5, isSorted: true, distinctCount: 4});
+});
+
+describe('withStream', () => {
+  // cudaStreamPerThread
+  const stream = 2;
+
+  test('enqueues operations on the stream and records it on the results', () => {
+    const col    = new Column({type: new Int32, data: new Int32Buffer([1, 2, 3])});
+    const result = withStream(stream, () => {
+      expect(getCurrentStream()).toBe(stream);
+      return col.add(col);
+    });
+    expect(getCurrentStream()).toBe(0);
+    expect(result.data.stream).toBe(stream);
+    expect([...Series.new(result).toArrow()]).toEqual([2, 4, 6]);
+  });
+
+  test('restores the previous stream when the function throws', () => {
+    expect(() => withStream(stream, () => { throw new Error('boom'); })).toThrow('boom');
+    expect(getCurrentStream()).toBe(0);
+  });
+});
+
+describe('spilling', () => {
+  const nextTick = () => new Promise((resolve) => setImmediate(resolve));
+
+  afterEach(() => setSpillOptions({deviceLimit: Infinity}));
+
+  test('spills the least-recently-used columns over the device limit', async () => {
+    setSpillOptions({deviceLimit: 4000});
+    const a = new Column({type: new Int32, data: new Int32Buffer(1000).fill(1)});
+    const b = new Column({type: new Int32, data: new Int32Buffer(1000).fill(2)});
+
+    a.spillable = true;
+    await nextTick();
+    b.spillable = true;
+    expect(a.spilled).toBe(true);
+    expect(b.spilled).toBe(false);
+
+    const {unspillCount} = getSpillStats();
+    await nextTick();
+    expect(a.getValue(999)).toBe(1);
+    expect(a.spilled).toBe(false);
+    expect(b.spilled).toBe(true);
+    expect(getSpillStats().unspillCount).toBe(unspillCount + 1);
+  });
+
+  test('does not spill columns used in the current turn of the event loop', () => {
+    setSpillOptions({deviceLimit: 0});
+    const a = new Column({type: new Int32, data: new Int32Buffer([1, 2, 3])});
+    a.spillable = true;
+    expect(a.spilled).toBe(false);
+    expect(a.spill()).toBe(12);
+    expect(a.spilled).toBe(true);
+    expect(a.getValue(2)).toBe(3);
+  });
+
+  test('does not spill columns whose device memory is shared', () => {
+    const a = new Column({type: new Int32, data: new Int32Buffer([1, 2, 3])});
+    const b = new Column({type: new Int32, data: a.data});
+    expect(a.spill()).toBe(0);
+    expect(b.spill()).toBe(0);
+    expect(a.spilled).toBe(false);
+
+    const c    = new Column({type: new Int32, data: new Int32Buffer([1, 2, 3])});
+    const view = c.data.view(4);
+    expect(c.spill()).toBe(0);
+    expect(new Int32Buffer(view).toArray()).toEqual(new Int32Array([2, 3]));
+  });
+
+  test('spills columns to retry failed allocations', async () => {
+    const limited = spillOnAllocationFailure(new LimitingResourceAdaptor(mr, 12000));
+    const src     = new Column({type: new Int32, data: new Int32Buffer(1000).fill(1)});
+    const a       = src.add(1, limited);
+    a.spillable   = true;
+    await nextTick();
+    // Only one 8000-byte result fits under the limit, so this spills `a` and retries
+    const b = src.add(2, limited);
+    expect(a.spilled).toBe(true);
+    expect(b.getValue(999)).toBe(3);
+  });
+});
@@ -13,8 +13,19 @@
 // limitations under the License.
 
 import {Float32Buffer, Int32Buffer, setDefaultAllocator, Uint8Buffer} from '@nvidia/cuda';
-import {Bool8, DataFrame, Float32, Int32, NullOrder, Series, Table} from '@nvidia/cudf';
+import {
+  Bool8,
+  DataFrame,
+  DataFrameBuilder,
+  Float32,
+  Int32,
+  NullOrder,
+  Series,
+  Table,
+  Utf8String
+} from '@nvidia/cudf';
 import {CudaMemoryResource, DeviceBuffer} from '@nvidia/rmm';
+import * as arrow from 'apache-arrow';
 import {BoolVector} from 'apache-arrow'
 
 const mr = new CudaMemoryResource();
@@ -420,3 +431,191 @@ test('dataframe.nansToNulls', () => {
 
   expect(result.get('b').nullCount).toEqual(1);
 });
+
+describe('DataFrame.join', () => {
+  const lhs = new DataFrame({
+    'id': Series.new({type: new Int32, data: new Int32Buffer([0, 1, 2, 3])}),
+    'a': Series.new({type: new Float32, data: new Float32Buffer([0, 10, 20, 30])}),
+  });
+  const rhs = new DataFrame({
+    'id': Series.new({type: new Int32, data: new Int32Buffer([1, 3, 5])}),
+    'b': Series.new({type: new Float32, data: new Float32Buffer([100, 300, 500])}),
+  });
+  const sortById = (df: DataFrame) =>
+    df.gather(df.orderBy({'id': {ascending: true, null_order: NullOrder.AFTER}}));
+
+  test('inner', () => {
+    const result = sortById(lhs.join(rhs, {on: ['id']}));
+    expect(result.names).toEqual(['id', 'a', 'b']);
+    expect([...result.get('id').toArrow()]).toEqual([1, 3]);
+    expect([...result.get('a').toArrow()]).toEqual([10, 30]);
+    expect([...result.get('b').toArrow()]).toEqual([100, 300]);
+  });
+
+  test('left', () => {
+    const result = sortById(lhs.join(rhs, {on: ['id'], how: 'left'}));
+    expect([...result.get('id').toArrow()]).toEqual([0, 1, 2, 3]);
+    expect([...result.get('b').toArrow()]).toEqual([null, 100, null, 300]);
+  });
+
+  test('outer', () => {
+    const result = sortById(lhs.join(rhs, {on: ['id'], how: 'outer'}));
+    expect([...result.get('id').toArrow()]).toEqual([0, 1, 2, 3, 5]);
+    expect([...result.get('a').toArrow()]).toEqual([0, 10, 20, 30, null]);
+    expect([...result.get('b').toArrow()]).toEqual([null, 100, null, 300, 500]);
+  });
+
+  test('leftsemi and leftanti', () => {
+    const semi = sortById(lhs.join(rhs, {on: ['id'], how: 'leftsemi'}));
+    const anti = sortById(lhs.join(rhs, {on: ['id'], how: 'leftanti'}));
+    expect(semi.names).toEqual(['id', 'a']);
+    expect([...semi.get('id').toArrow()]).toEqual([1, 3]);
+    expect([...anti.get('id').toArrow()]).toEqual([0, 2]);
+  });
+
+  test('reuses a prebuilt index', () => {
+    const index = rhs.joinIndex(['id']);
+    const first = sortById(lhs.join(rhs, {on: ['id'], index}));
+    const again = sortById(lhs.join(rhs, {on: ['id'], index}));
+    expect([...first.get('b').toArrow()]).toEqual([100, 300]);
+    expect([...again.get('b').toArrow()]).toEqual([100, 300]);
+  });
+
+  test('rejects an index that does not match the join', () => {
+    expect(() => lhs.join(rhs, {on: ['id'], index: lhs.joinIndex(['id'])})).toThrow();
+    const index = rhs.joinIndex(['id'], false);
+    expect(() => lhs.join(rhs, {on: ['id'], index})).toThrow();
+    expect([...lhs.join(rhs, {on: ['id'], index, nullEquality: false}).get('id').toArrow()].length)
+      .toBe(2);
+  });
+});
+
+test('DataFrame.sortValues', () => {
+  const a      = Series.new({type: new Int32(), data: new Int32Buffer([1, 3, 1, 0])});
+  const b      = Series.new({type: new Float32(), data: new Float32Buffer([4, 3, 2, 1])});
+  const df     = new DataFrame({'a': a, 'b': b});
+  const spec   = {'a': {ascending: true, null_order: NullOrder.BEFORE}};
+  const result = df.sortValues(spec, true);
+  expect([...result.get('a').toArrow()]).toEqual([0, 1, 1, 3]);
+  expect([...result.get('b').toArrow()]).toEqual([1, 4, 2, 3]);
+});
+
+test('DataFrame.nlargest and DataFrame.nsmallest', () => {
+  const a  = Series.new({type: new Int32(), data: new Int32Buffer([1, 3, 5, 0])});
+  const b  = Series.new({type: new Float32(), data: new Float32Buffer([4, 3, 2, 1])});
+  const df = new DataFrame({'a': a, 'b': b});
+  expect([...df.nlargest(2, ['a']).get('b').toArrow()]).toEqual([2, 3]);
+  expect([...df.nsmallest(2, ['a']).get('b').toArrow()]).toEqual([1, 4]);
+});
+
+test('DataFrame.nlargest and DataFrame.nsmallest only sort candidate rows', () => {
+  // Enough rows that a sampled threshold filters them first, with ties broken by row order
+  const n  = 100000;
+  const a  = Array.from({length: n}, (_, i) => i % 1000);
+  const c  = a.map((x, i) => i === 500 ? NaN : x);
+  const df = new DataFrame({
+    'a': Series.new({type: new Int32(), data: new Int32Buffer(a)}),
+    'b': Series.new({type: new Int32(), data: new Int32Buffer(a.map((_, i) => i))}),
+    'c': Series.new({type: new Float32(), data: new Float32Buffer(c)}),
+  });
+  expect([...df.nlargest(5, ['a']).get('b').toArrow()]).toEqual([999, 1999, 2999, 3999, 4999]);
+  expect([...df.nsmallest(5, ['a']).get('b').toArrow()]).toEqual([0, 1000, 2000, 3000, 4000]);
+  expect([...df.nlargest(2, ['c']).get('b').toArrow()]).toEqual([500, 999]);
+});
+
+test('Table.reduceAll', () => {
+  const a     = Series.new({type: new Int32(), data: new Int32Buffer([1, 3, 5, 0])});
+  const b     = Series.new({type: new Float32(), data: new Float32Buffer([4, 3, 2, 1])});
+  const table = new DataFrame({'a': a, 'b': b}).asTable();
+  const stats = table.reduceAll(['count', 'min', 'max', 'mean']);
+  expect(stats.count).toEqual([4, 4]);
+  expect(stats.min).toEqual([0, 1]);
+  expect(stats.max).toEqual([5, 4]);
+  expect(stats.mean).toEqual([2.25, 2.5]);
+  const {quantiles} = table.reduceAll(['count'], [0, 0.5, 1]);
+  expect(quantiles).toEqual([[0, 1], [2, 2.5], [5, 4]]);
+});
+
+test('DataFrame.describe', () => {
+  const a      = Series.new({type: new Int32(), data: new Int32Buffer([1, 2, 3, 4])});
+  const b      = Series.new({type: new Utf8String(), data: ['a', 'b', 'c', 'd']});
+  const df     = new DataFrame({'a': a, 'b': b});
+  const result = df.describe();
+  expect(result.names).toEqual(['a']);
+  expect([...result.get('a').toArrow()])
+    .toEqual([4, 2.5, 1.2909944487358056, 1, 1.75, 2.5, 3.25, 4]);
+});
+
+test('DataFrameBuilder appends TypedArrays and Arrow batches', () => {
+  const builder = new DataFrameBuilder({id: new Int32, value: new Float32});
+  builder.append({id: new Int32Array([1, 2]), value: new Float32Array([0.5, 1.5])});
+  builder.append(arrow.Table.new({
+    id: arrow.Int32Vector.from([3]),
+    value: arrow.Float32Vector.from([2.5]),
+  }));
+
+  const df = builder.snapshot();
+  expect(df.numRows).toBe(3);
+  expect([...df.get('id').toArrow()]).toEqual([1, 2, 3]);
+  expect([...df.get('value').toArrow()]).toEqual([0.5, 1.5, 2.5]);
+});
+
+test('DataFrameBuilder throws on batches missing a column', () => {
+  const builder = new DataFrameBuilder({id: new Int32, value: new Float32});
+  expect(() => builder.append(arrow.Table.new({id: arrow.Int32Vector.from([1])})))
+    .toThrow(/missing column 'value'/);
+  expect(() => builder.append({id: new Int32Array([1])} as any)).toThrow(/missing column 'value'/);
+  expect(builder.numRows).toBe(0);
+});
+
+test('DataFrame.hashPartition', () => {
+  const df = new DataFrame({
+    key: Series.new({type: new Int32, data: new Int32Buffer([1, 2, 1, 2, 3])}),
+    value: Series.new({type: new Float32, data: new Float32Buffer([1, 2, 3, 4, 5])}),
+  });
+
+  const parts = df.hashPartition(['key'], 4);
+  expect(parts).toHaveLength(4);
+  expect(parts.reduce((rows, part) => rows + part.numRows, 0)).toBe(5);
+  expect(parts[0].names).toEqual(['key', 'value']);
+  // Equal keys land in the same partition
+  const withKey = (key: number) =>
+    parts.filter((part) => [...part.get('key').toArrow()].includes(key));
+  expect(withKey(1)).toHaveLength(1);
+  expect(withKey(2)).toHaveLength(1);
+  expect([...withKey(1)[0].get('key').toArrow()].filter((key) => key === 1)).toHaveLength(2);
+});
+
+describe('DataFrame.dropDuplicates', () => {
+  const df = new DataFrame({
+    a: Series.new({type: new Int32, data: [2, 1, 2, 1, 3]}),
+    b: Series.new({type: new Int32, data: [0, 1, 2, 3, 4]}),
+  });
+
+  test('keep first', () => {
+    const result = df.dropDuplicates('first', true, ['a']);
+    expect([...result.get('a').toArrow()]).toEqual([1, 2, 3]);
+    expect([...result.get('b').toArrow()]).toEqual([1, 0, 4]);
+  });
+
+  test('keep last', () => {
+    const result = df.dropDuplicates('last', true, ['a']);
+    expect([...result.get('a').toArrow()]).toEqual([1, 2, 3]);
+    expect([...result.get('b').toArrow()]).toEqual([3, 2, 4]);
+  });
+
+  test('compares every column when subset is omitted', () => {
+    const result = df.dropDuplicates('last');
+    expect(result.numRows).toBe(5);
+  });
+
+  test('keep none', () => {
+    const result = df.dropDuplicates('none', true, ['a']);
+    expect([...result.get('a').toArrow()]).toEqual([3]);
+  });
+
+  test('distinctCount', () => {
+    expect(df.distinctCount(['a'])).toBe(3);
+    expect(df.distinctCount()).toBe(5);
+  });
+});
@@ -389,3 +389,41 @@ test(`Groupby quantile null values`, () => {
   expect(result.get('b').length).toBe(1);
   expect(result.get('b').nullCount).toBe(1);
 });
+
+test(`Groupby rolling`, () => {
+  const a      = Series.new({type: new Int32, data: [1, 1, 2, 1, 2]});
+  const b      = Series.new({type: new Float64, data: [1, 2, 3, 4, 5]});
+  const df     = new DataFrame({'a': a, 'b': b});
+  const grp    = new GroupBy({obj: df, by: ['a']});
+  const result = grp.rolling('sum', 2, {minPeriods: 1});
+  expect([...result.get('a').toArrow()]).toEqual([1, 1, 1, 2, 2]);
+  expect([...result.get('b').toArrow()]).toEqual([1, 3, 6, 3, 8]);
+});
+
+test(`Groupby expanding`, () => {
+  const a      = Series.new({type: new Int32, data: [1, 1, 2, 1, 2]});
+  const b      = Series.new({type: new Float64, data: [1, 2, 3, 4, 5]});
+  const df     = new DataFrame({'a': a, 'b': b});
+  const grp    = new GroupBy({obj: df, by: ['a']});
+  const result = grp.expanding('sum');
+  expect([...result.get('a').toArrow()]).toEqual([1, 1, 1, 2, 2]);
+  expect([...result.get('b').toArrow()]).toEqual([1, 3, 7, 3, 8]);
+});
+
+test(`Groupby quantile multiple`, () => {
+  const a      = Series.new({type: new Int32, data: [1, 1, 1, 2, 2]});
+  const b      = Series.new({type: new Float64, data: [1, 2, 3, 4, 6]});
+  const df     = new DataFrame({'a': a, 'b': b});
+  const grp    = new GroupBy({obj: df, by: ['a']});
+  const result = grp.quantile([0, 0.5, 1]);
+  expect([...result.get('a').toArrow()]).toEqual([1, 2]);
+  expect([...result.get('b').toArrow()].map((x: any) => [...x])).toEqual([[1, 2, 3], [4, 5, 6]]);
+});
+
+test('Groupby dictionary keys', () => {
+  const df     = makeBasicData([0, 1, 2, 3, 4, 5, 6, 7, 8, 9]);
+  const dict   = new DataFrame({'a': df.get('a').encodeDictionary(), 'b': df.get('b')});
+  const result = new GroupBy({obj: dict, by: ['a']}).sum();
+  expect([...result.get('a').toArrow()]).toEqual([1, 2, 3]);
+  expect([...result.get('b').toArrow()]).toEqual([9, 19, 17]);
+});
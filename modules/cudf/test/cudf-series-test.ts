@@ -13,8 +13,21 @@
 // limitations under the License.
 
 import {Float32Buffer, Int32Buffer, setDefaultAllocator, Uint8Buffer} from '@nvidia/cuda';
-import {Bool8, Column, Float32, Int32, NullOrder, Series, Uint8, Utf8String} from '@nvidia/cudf';
+import {
+  Bool8,
+  Column,
+  DictionarySeries,
+  Float32,
+  Float64,
+  Int32,
+  NullOrder,
+  Series,
+  Table,
+  Uint8,
+  Utf8String
+} from '@nvidia/cudf';
 import {CudaMemoryResource, DeviceBuffer} from '@nvidia/rmm';
+import * as arrow from 'apache-arrow';
 import {Uint8Vector, Utf8Vector} from 'apache-arrow';
 import {BoolVector} from 'apache-arrow'
 
@@ -210,6 +223,17 @@ test('Series.sortValues (descending)', () => {
   expect([...result.toArrow()]).toEqual(expected);
 });
 
+test('Series.nlargest', () => {
+  const col = Series.new({type: new Int32(), data: [1, null, 5, 4, 2, 0]});
+  expect([...col.nlargest(3).toArrow()]).toEqual([5, 4, 2]);
+  expect([...col.nlargest(10).toArrow()]).toEqual([5, 4, 2, 1, 0, null]);
+});
+
+test('Series.nsmallest', () => {
+  const col = Series.new({type: new Int32(), data: [1, null, 5, 4, 2, 0]});
+  expect([...col.nsmallest(3).toArrow()]).toEqual([0, 1, 2]);
+});
+
 test('Series.dropNulls (drop nulls only)', () => {
   const mask = new Uint8Buffer(BoolVector.from([0, 1, 1, 1, 1, 0]).values);
   const col =
@@ -240,3 +264,65 @@ test('FloatSeries.nansToNulls', () => {
   expect(result.nullCount).toEqual(1);
   expect(col.nullCount).toEqual(0);
 });
+
+test('Series.rolling', () => {
+  const s = Series.new({type: new Float64, data: [1, 2, 3, 4, 5]});
+  expect([...s.rolling('sum', 2).toArrow()]).toEqual([null, 3, 5, 7, 9]);
+  expect([...s.rolling('mean', 3, {minPeriods: 1, center: true}).toArrow()])
+    .toEqual([1.5, 2, 3, 4, 4.5]);
+});
+
+test('Series.expanding', () => {
+  const s = Series.new({type: new Float64, data: [1, 2, 3, 4, 5]});
+  expect([...s.expanding('sum').toArrow()]).toEqual([1, 3, 6, 10, 15]);
+  expect([...s.expanding('max', {minPeriods: 2}).toArrow()]).toEqual([null, 2, 3, 4, 5]);
+});
+
+test('Series.rollingRange', () => {
+  const s       = Series.new({type: new Float64, data: [1, 2, 3, 4, 5]});
+  const orderBy = Series.new({type: new Int32, data: [1, 2, 4, 8, 9]});
+  expect([...s.rollingRange('sum', orderBy, 2).toArrow()]).toEqual([1, 3, 5, 4, 9]);
+});
+
+test('Series.encodeDictionary', () => {
+  const s = Series.new({type: new Int32, data: [3, 1, 3, 2, 1]});
+  const d = s.encodeDictionary() as DictionarySeries<Int32>;
+  expect(d.type.typeId).toBe(arrow.Type.Dictionary);
+  expect([...d.categories.toArrow()]).toEqual([1, 2, 3]);
+  expect([...d.codes.toArrow()]).toEqual([2, 0, 2, 1, 0]);
+  expect([...d.decode().toArrow()]).toEqual([3, 1, 3, 2, 1]);
+  expect([...d.gt(1).toArrow()]).toEqual([true, false, true, true, false]);
+});
+
+test('DictionarySeries slices', () => {
+  const s       = Series.new({type: new Int32, data: [3, 1, null, 2, 1, 3]});
+  const d       = s.encodeDictionary() as DictionarySeries<Int32>;
+  const [slice] = new Table({columns: [d._col]}).slice([1, 5]);
+  const sliced  = Series.new(slice.getColumnByIndex(0)) as DictionarySeries<Int32>;
+  expect(sliced.offset).toBe(1);
+  expect([...sliced.codes.toArrow()].filter((_, i) => i !== 1)).toEqual([0, 1, 0]);
+  expect([...sliced.decode().toArrow()]).toEqual([1, null, 2, 1]);
+  expect([...sliced.eq(1).toArrow()]).toEqual([true, null, false, true]);
+  expect([...sliced.gt(1).toArrow()]).toEqual([false, null, true, false]);
+});
+
+test('Column.makeDictionary rejects indices that name no key', () => {
+  const keys = Series.new({type: new Int32, data: [10, 20]})._col;
+  const make = (data: (number|null)[]) =>
+    Column.makeDictionary(keys, Series.new({type: new Int32, data})._col);
+  expect(() => make([0, 2])).toThrow();
+  expect(() => make([-1, 0])).toThrow();
+  const d = Series.new(make([1, null, 0])) as DictionarySeries<Int32>;
+  expect([...d.decode().toArrow()]).toEqual([20, null, 10]);
+  expect([...d.eq(10).toArrow()]).toEqual([false, null, true]);
+});
+
+test('DictionarySeries from and to an Arrow DictionaryVector', () => {
+  const type   = new arrow.Dictionary(new arrow.Utf8, new arrow.Int32);
+  const vector = arrow.Vector.from({type, values: ['b', 'a', 'b', null]});
+  const d      = Series.new(vector) as any as DictionarySeries<Utf8String>;
+  expect([...d.categories.toArrow()]).toEqual(['a', 'b']);
+  expect([...d.decode().toArrow()]).toEqual(['b', 'a', 'b', null]);
+  expect([...d.eq('b').toArrow()]).toEqual([true, false, true, null]);
+  expect([...d.toArrow()]).toEqual(['b', 'a', 'b', null]);
+});
@@ -18,7 +18,9 @@ import {
   Column,
   Float32,
   Int32,
+  Series,
   Table,
+  TableBuilder,
 } from '@nvidia/cudf';
 import {CudaMemoryResource, DeviceBuffer} from '@nvidia/rmm';
 import * as arrow from 'apache-arrow';
@@ -121,3 +123,63 @@ test('Table.gather (bitmask)', () => {
   expect(r1.getValue(1)).toBe(4.0);
   expect(r1.getValue(2)).toBe(5.0);
 });
+
+describe('TableBuilder', () => {
+  test('appends batches with geometric capacity growth', () => {
+    const builder = new TableBuilder([new Int32, new Float32]);
+    expect(builder.append([new Int32Array([0, 1, 2]), new Float32Array([0, 0.5, 1])])).toBe(3);
+    expect(builder.capacity).toBe(3);
+    expect(builder.append([new Int32Buffer([3]), new Float32Buffer([1.5])])).toBe(4);
+    expect(builder.capacity).toBe(6);
+
+    const table = builder.snapshot();
+    expect(table.numRows).toBe(4);
+    expect([...Series.new(table.getColumnByIndex<Int32>(0)).toArrow()]).toEqual([0, 1, 2, 3]);
+  });
+
+  test('snapshots are not affected by later appends', () => {
+    const builder = new TableBuilder([new Int32], 2);
+    builder.append([new Int32Array([1, 2])]);
+    const snapshot = builder.snapshot();
+    builder.append([Series.new({type: new Int32, data: [null, 4, 5]})._col]);
+
+    expect([...Series.new(snapshot.getColumnByIndex<Int32>(0)).toArrow()]).toEqual([1, 2]);
+    expect([...Series.new(builder.snapshot().getColumnByIndex<Int32>(0)).toArrow()])
+      .toEqual([1, 2, null, 4, 5]);
+  });
+});
+
+test('Table.slice and Table.split share device memory', () => {
+  const col   = new Column({type: new Int32, data: new Int32Buffer([0, 1, 2, 3, 4, 5])});
+  const table = new Table({columns: [col]});
+
+  const [a, b] = table.slice([1, 3, 3, 3]);
+  expect(a.getColumnByIndex(0).data).toBe(col.data);
+  expect([...Series.new(a.getColumnByIndex<Int32>(0)).toArrow()]).toEqual([1, 2]);
+  expect(b.numRows).toBe(0);
+
+  const parts = table.split([2, 5]);
+  expect(parts.map((part) => part.numRows)).toEqual([2, 3, 1]);
+  expect([...Series.new(parts[2].getColumnByIndex<Int32>(0)).toArrow()]).toEqual([5]);
+});
+
+test('Table.hashPartition', () => {
+  const keys  = new Column({type: new Int32, data: new Int32Buffer([1, 2, 3, 1, 2, 3, 1])});
+  const table = new Table({columns: [keys]});
+
+  const {table: partitioned, offsets} = table.hashPartition([0], 3);
+  expect(partitioned.numRows).toBe(7);
+  expect(offsets).toHaveLength(3);
+  expect(offsets[0]).toBe(0);
+
+  // Equal keys land in the same partition
+  const parts = partitioned.split(offsets.slice(1));
+  const seen  = new Map<number, number>();
+  parts.forEach((part, i) => {
+    for (const key of Series.new(part.getColumnByIndex<Int32>(0)).toArrow()) {
+      expect(seen.get(key!) ?? i).toBe(i);
+      seen.set(key!, i);
+    }
+  });
+  expect(seen.size).toBe(3);
+});
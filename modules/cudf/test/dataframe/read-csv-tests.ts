@@ -13,7 +13,7 @@
 // limitations under the License.
 
 import {setDefaultAllocator} from '@nvidia/cuda';
-import {DataFrame} from '@nvidia/cudf';
+import {CSVSchemaCache, DataFrame} from '@nvidia/cudf';
 import {DeviceBuffer} from '@nvidia/rmm';
 
 import {mkdtempSync, promises} from 'fs';
@@ -62,6 +62,36 @@ describe('DataFrame.readCSV', () => {
   });
 });
 
+describe('CSVSchemaCache', () => {
+  const read = (schemaCache: CSVSchemaCache, rows: any[]) => DataFrame.readCSV({
+    sourceType: 'buffers',
+    sources: [Buffer.from(makeCSVString({rows}))],
+    schemaCache,
+  });
+
+  test('reuses the inferred schema for sources with the same header', () => {
+    const schemaCache = new CSVSchemaCache();
+    const df1         = read(schemaCache, [{a: 0, b: 1.5, c: 'x'}]);
+    const df2         = read(schemaCache, [{a: 1, b: 2.5, c: 'y'}]);
+    expect(schemaCache.misses).toBe(1);
+    expect(schemaCache.hits).toBe(1);
+    expect(df2.names).toEqual(df1.names);
+    expect(df2.get('a').type).toEqual(df1.get('a').type);
+    expect([...df2.get('b').toArrow()]).toEqual([2.5]);
+    expect([...df2.get('c').toArrow()]).toEqual(['y']);
+  });
+
+  test('can be exported and imported as JSON', () => {
+    const schemaCache = new CSVSchemaCache();
+    read(schemaCache, [{a: 0, b: 1.5, c: 'x'}]);
+    const imported = CSVSchemaCache.fromJSON(schemaCache.toJSON());
+    expect(imported.size).toBe(1);
+    read(imported, [{a: 1, b: 2.5, c: 'y'}]);
+    expect(imported.hits).toBe(1);
+    expect(imported.misses).toBe(0);
+  });
+});
+
 let csvTmpDir = '';
 
 const rimraf = require('rimraf');
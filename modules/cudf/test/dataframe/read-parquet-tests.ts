@@ -0,0 +1,79 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import {setDefaultAllocator} from '@nvidia/cuda';
+import {DataFrame, Table} from '@nvidia/cudf';
+import {DeviceBuffer} from '@nvidia/rmm';
+
+import {readFileSync} from 'fs';
+import * as Path from 'path';
+
+setDefaultAllocator((byteLength: number) => new DeviceBuffer(byteLength));
+
+// Both fixtures hold the rows {a: int32, b: float64, c: string} = (0, 1.0, '2') ... (3, 4.0, '5').
+// simple.parquet has one row group, and row-groups.parquet has two row groups of two rows each.
+const simplePath    = Path.join(__dirname, 'fixtures', 'simple.parquet');
+const rowGroupsPath = Path.join(__dirname, 'fixtures', 'row-groups.parquet');
+
+describe('Table.readParquet', () => {
+  test('can read a Parquet buffer', () => {
+    const {names, table} = Table.readParquet({
+      sourceType: 'buffers',
+      sources: [readFileSync(simplePath)],
+    });
+    expect(names).toEqual(['a', 'b', 'c']);
+    expect(table.numColumns).toBe(3);
+    expect(table.getColumnByIndex(0).length).toBe(4);
+  });
+});
+
+describe('DataFrame.readParquet', () => {
+  test('can read a Parquet buffer', () => {
+    const df = DataFrame.readParquet({
+      sourceType: 'buffers',
+      sources: [readFileSync(simplePath)],
+    });
+    expect(df.get('a').toArrow().values).toEqual(new Int32Array([0, 1, 2, 3]));
+    expect(df.get('b').toArrow().toArray()).toEqual(new Float64Array([1.0, 2.0, 3.0, 4.0]));
+    expect([...df.get('c').toArrow()]).toEqual(['2', '3', '4', '5']);
+  });
+
+  test('can read a Parquet file', () => {
+    const df = DataFrame.readParquet({sourceType: 'files', sources: [simplePath]});
+    expect(df.get('a').toArrow().values).toEqual(new Int32Array([0, 1, 2, 3]));
+    expect([...df.get('c').toArrow()]).toEqual(['2', '3', '4', '5']);
+  });
+
+  test('reads selected columns and rows', () => {
+    const df = DataFrame.readParquet({
+      sourceType: 'files',
+      sources: [simplePath],
+      columns: ['c', 'a'],
+      skipRows: 1,
+      numRows: 2,
+    });
+    expect([...df.names].sort()).toEqual(['a', 'c']);
+    expect([...df.get('a').toArrow()]).toEqual([1, 2]);
+    expect([...df.get('c').toArrow()]).toEqual(['3', '4']);
+  });
+
+  test('reads selected row groups', () => {
+    const df = DataFrame.readParquet({
+      sourceType: 'files',
+      sources: [rowGroupsPath],
+      rowGroups: [[1]],
+    });
+    expect([...df.get('a').toArrow()]).toEqual([2, 3]);
+  });
+});
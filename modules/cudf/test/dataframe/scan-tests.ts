@@ -0,0 +1,67 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import {setDefaultAllocator} from '@nvidia/cuda';
+import {DataFrame} from '@nvidia/cudf';
+import {DeviceBuffer} from '@nvidia/rmm';
+
+import {readFileSync} from 'fs';
+import * as Path from 'path';
+
+import {makeCSVString} from './utils';
+
+setDefaultAllocator((byteLength: number) => new DeviceBuffer(byteLength));
+
+// The same four rows, read lazily from each format
+const rows = [
+  {a: 0, b: 1.0, c: '2'},
+  {a: 1, b: 2.0, c: '3'},
+  {a: 2, b: 3.0, c: '4'},
+  {a: 3, b: 4.0, c: '5'},
+];
+
+describe.each([
+  [
+    'DataFrame.scanCSV',
+    () => DataFrame.scanCSV({
+      header: 0,
+      sourceType: 'buffers',
+      sources: [Buffer.from(makeCSVString({rows}))],
+      dataTypes: {a: 'int32', b: 'float64', c: 'str'},
+    }),
+  ],
+  [
+    'DataFrame.scanParquet',
+    () => DataFrame.scanParquet({
+      sourceType: 'buffers',
+      sources: [readFileSync(Path.join(__dirname, 'fixtures', 'simple.parquet'))],
+    }),
+  ],
+])('%s', (_, scan) => {
+  test('pushes select and filter columns down into the reader', () => {
+    const plan = scan().filter(['b'], (df) => df.get('b').gt(1.5)).select(['a']);
+    expect(plan.pushdown).toEqual({columns: ['a', 'b'], numRows: undefined});
+    const df = plan.collect();
+    expect(df.names).toEqual(['a']);
+    expect([...df.get('a').toArrow()]).toEqual([1, 2, 3]);
+  });
+
+  test('pushes a leading head down into the reader', () => {
+    const plan = scan().head(3).filter(['a'], (df) => df.get('a').gt(0)).head(1);
+    expect(plan.pushdown).toEqual({columns: undefined, numRows: 3});
+    const df = plan.collect();
+    expect(df.numRows).toBe(1);
+    expect([...df.get('c').toArrow()]).toEqual(['3']);
+  });
+});
@@ -90,3 +90,17 @@ param_q.forEach(q => {
     });
   });
 });
+
+describe('Series.quantile (multiple quantiles)', () => {
+  test('matches the single quantile results', () => {
+    const s = Series.new({type: new Int32, data: new Int32Array(makeNumbers())});
+    param_interpolation.forEach((interop, idx) => {
+      expect([...s.quantile(param_q, interop).toArrow()])
+        .toEqual(param_q.map((q) => quantile_number_results.get(q)?.[idx]));
+    });
+  });
+  test('ignores nulls', () => {
+    const s = Series.new({type: new Float64, data: [4, null, 1, 3, null, 2]});
+    expect([...s.quantile([0, 0.5, 1]).toArrow()]).toEqual([1, 2.5, 4]);
+  });
+});
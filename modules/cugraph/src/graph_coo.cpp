@@ -62,6 +62,8 @@ void GraphCOO::Finalize(Napi::Env env) {}
 
 ValueWrap<size_t> GraphCOO::num_nodes() {
   if (!node_count_computed_) {
+    // Computed once per graph. view() takes mutable views of the edge columns, which discards
+    // their cached min and max, so another graph over the same columns computes them again.
     auto const& src      = *Column::Unwrap(src_.Value());
     auto const& dst      = *Column::Unwrap(dst_.Value());
     auto src_max         = src.minmax().second->get_value().ToNumber();
@@ -76,20 +78,30 @@ ValueWrap<size_t> GraphCOO::num_edges() {
   if (!edge_count_computed_) {
     auto const& dst      = *Column::Unwrap(src_.Value());
     auto const& src      = *Column::Unwrap(dst_.Value());
-    edge_count_          = directed_edges_ ? src.size() : src[src >= dst]->size();
+    // Count the `src >= dst` edges with a sum reduction instead of gathering them
+    edge_count_ = directed_edges_ ? src.size()
+                                  : (src >= dst)
+                                      ->reduce(cudf::make_sum_aggregation(),
+                                               cudf::data_type{cudf::type_id::INT32})
+                                      ->get_value()
+                                      .ToNumber()
+                                      .Int32Value();
     edge_count_computed_ = true;
   }
   return {Env(), edge_count_};
 }
 
 cugraph::GraphCOOView<int32_t, int32_t, float> GraphCOO::view() {
-  auto src = Column::Unwrap(src_.Value())->mutable_view();
-  auto dst = Column::Unwrap(dst_.Value())->mutable_view();
+  // Compute the counts before taking mutable views, which invalidate the Columns' cached stats
+  size_t const node_count = num_nodes();
+  size_t const edge_count = num_edges();
+  auto src                = Column::Unwrap(src_.Value())->mutable_view();
+  auto dst                = Column::Unwrap(dst_.Value())->mutable_view();
   return cugraph::GraphCOOView<int32_t, int32_t, float>(src.begin<int32_t>(),
                                                         dst.begin<int32_t>(),
                                                         nullptr,  // edge_weights
-                                                        num_nodes(),
-                                                        num_edges());
+                                                        node_count,
+                                                        edge_count);
 }
 
 Napi::Value GraphCOO::num_nodes(Napi::CallbackInfo const& info) { return num_nodes(); }
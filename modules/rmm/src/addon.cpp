@@ -34,6 +34,7 @@ Napi::Value set_per_device_resource(CallbackArgs const& args) {
 Napi::Object initModule(Napi::Env env, Napi::Object exports) {
   EXPORT_FUNC(env, exports, "init", nv::rmmInit);
   EXPORT_FUNC(env, exports, "setPerDeviceResource", nv::set_per_device_resource);
+  EXPORT_FUNC(env, exports, "replayAllocationLog", nv::replay_allocation_log);
   nv::MemoryResource::Init(env, exports);
   nv::DeviceBuffer::Init(env, exports);
   return exports;
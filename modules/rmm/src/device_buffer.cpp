@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include "node_rmm/bounce_buffer_pool.hpp"
 #include "node_rmm/device_buffer.hpp"
 #include "node_rmm/memory_resource.hpp"
 #include "node_rmm/utilities/cpp_to_napi.hpp"
@@ -19,8 +20,68 @@
 
 #include <node_cuda/utilities/error.hpp>
 
+#include <nv_node/async/task.hpp>
+
+#include <algorithm>
+#include <cstring>
+
 namespace nv {
 
+namespace {
+
+/**
+ * @brief Copies host memory into a DeviceBuffer on a libuv worker thread, staging through the
+ * pinned bounce buffer pool, then resolves with the DeviceBuffer.
+ */
+class upload_task : public Task {
+ public:
+  upload_task(Napi::Env env,
+              Napi::Object const& source,
+              Span<char> const& src,
+              DeviceBuffer* dst,
+              rmm::cuda_stream_view stream)
+    : Task(env, dst->Value()),
+      source_(Napi::Persistent(source)),
+      src_(src),
+      dst_(static_cast<char*>(dst->data())),
+      device_id_([&]() -> int32_t {
+        // Host memory resources report device -1, so stage through the active device's pool
+        int32_t const device = dst->device();
+        return device > -1 ? device : Device::active_device_id();
+      }()),
+      stream_(stream) {}
+
+ protected:
+  void Execute() override {
+    NODE_CUDA_TRY(cudaSetDevice(device_id_));
+    auto& pool = bounce_buffer_pool::get(device_id_);
+    for (size_t offset = 0; offset < src_.size(); offset += bounce_buffer_pool::chunk_size) {
+      auto const size = std::min(bounce_buffer_pool::chunk_size, src_.size() - offset);
+      auto chunk      = pool.acquire();
+      std::memcpy(chunk->data, src_.data() + offset, size);
+      auto status = cudaMemcpyAsync(
+        dst_ + offset, chunk->data, size, cudaMemcpyDefault, stream_.value());
+      if (status == cudaSuccess) { status = cudaEventRecord(chunk->copied, stream_.value()); }
+      pool.release(chunk);
+      if (status != cudaSuccess) { NODE_CUDA_THROW(status); }
+    }
+    NODE_CUDA_TRY(cudaStreamSynchronize(stream_.value()));
+  }
+
+  void OnError(Napi::Error const& e) override {
+    if (!settled_ && (settled_ = true)) { deferred_.Reject(e.Value()); }
+  }
+
+ private:
+  Napi::ObjectReference source_;  ///< Keeps the source alive until the copy completes
+  Span<char> src_;
+  char* dst_;
+  int32_t device_id_;
+  rmm::cuda_stream_view stream_;
+};
+
+}  // namespace
+
 ConstructorReference DeviceBuffer::constructor;
 
 Napi::Object DeviceBuffer::Init(Napi::Env env, Napi::Object exports) {
@@ -40,6 +101,9 @@ Napi::Object DeviceBuffer::Init(Napi::Env env, Napi::Object exports) {
                                       InstanceMethod<&DeviceBuffer::set_stream>("setStream"),
                                       InstanceMethod<&DeviceBuffer::shrink_to_fit>("shrinkToFit"),
                                       InstanceMethod<&DeviceBuffer::slice>("slice"),
+                                      InstanceMethod<&DeviceBuffer::view>("view"),
+                                      InstanceAccessor<&DeviceBuffer::is_view>("isView"),
+                                      StaticMethod<&DeviceBuffer::from_async>("fromAsync"),
                                     })))
       .SuppressDestruct();
     return DeviceBuffer::constructor.Value();
@@ -81,6 +145,53 @@ ObjectUnwrap<DeviceBuffer> DeviceBuffer::New(void* const data,
   return constructor.New(Span<char>(data, size), mr.object(), stream);
 }
 
+ObjectUnwrap<DeviceBuffer> DeviceBuffer::View(ObjectUnwrap<DeviceBuffer> const& parent,
+                                              size_t const offset,
+                                              size_t const size) {
+  NODE_CUDA_EXPECT(offset <= parent->size() && size <= parent->size() - offset,
+                   "DeviceBuffer view must be within the bounds of its parent",
+                   parent->Env());
+  // Views of views reference the owning DeviceBuffer directly
+  ObjectUnwrap<DeviceBuffer> owner = parent->is_view() ? parent->parent_.Value() : parent.object();
+  auto buf                         = New(parent->mr_.Value(), owner->buffer().stream());
+  buf->parent_                     = Napi::Persistent(owner.object());
+  buf->offset_                     = offset + (parent->is_view() ? parent->offset_ : 0);
+  buf->size_                       = size;
+  buf->parent_view_                = Share{owner->views_};
+  return buf;
+}
+
+Napi::Value DeviceBuffer::from_async(Napi::CallbackInfo const& info) {
+  CallbackArgs const args{info};
+  auto env    = info.Env();
+  auto& input = args[0];
+  NODE_CUDA_EXPECT(input.IsArrayBuffer() || input.IsTypedArray() || input.IsDataView(),
+                   "DeviceBuffer.fromAsync expects an ArrayBuffer or ArrayBufferView source",
+                   env);
+
+  auto opts = args[1].IsObject() ? args[1].ToObject() : Napi::Object::New(env);
+  auto mr   = opts.Get("memoryResource");
+  auto strm = opts.Get("stream");
+
+  rmm::cuda_stream_view stream = rmm::cuda_stream_default;
+  if (strm.IsNumber()) { stream = NapiToCPP(strm).operator rmm::cuda_stream_view(); }
+
+  auto buf = New(MemoryResource::is_instance(mr) ? ObjectUnwrap<MemoryResource>(mr)
+                                                 : MemoryResource::Cuda(),
+                 stream);
+
+  Span<char> src = input;
+  buf->buffer_.reset(new rmm::device_buffer(src.size(), stream, buf->get_mr()));
+  Napi::MemoryManagement::AdjustExternalMemory(env, src.size());
+
+  if (src.size() == 0) { return Task::Resolved(buf.object()); }
+
+  auto task    = new upload_task(env, input.ToObject(), src, buf, stream);
+  auto promise = task->Promise();
+  task->Resolve();
+  return promise;
+}
+
 DeviceBuffer::DeviceBuffer(CallbackArgs const& args) : Napi::ObjectWrap<DeviceBuffer>(args) {
   auto& arg0 = args[0];
   auto& arg1 = args[1];
@@ -123,7 +234,9 @@ DeviceBuffer::DeviceBuffer(CallbackArgs const& args) : Napi::ObjectWrap<DeviceBu
 }
 
 void DeviceBuffer::Finalize(Napi::Env env) {
-  if (size() > 0) { Napi::MemoryManagement::AdjustExternalMemory(env, -size()); }
+  parent_view_.reset();
+  // Views don't own memory, so only the owned buffer's size was reported to the VM
+  if (buffer_->size() > 0) { Napi::MemoryManagement::AdjustExternalMemory(env, -buffer_->size()); }
 }
 
 ValueWrap<int32_t> DeviceBuffer::device() const {
@@ -131,15 +244,19 @@ ValueWrap<int32_t> DeviceBuffer::device() const {
 }
 
 Napi::Value DeviceBuffer::byte_length(Napi::CallbackInfo const& info) {
-  return Napi::Number::New(info.Env(), buffer().size());
+  return Napi::Number::New(info.Env(), size());
 }
 
 Napi::Value DeviceBuffer::capacity(Napi::CallbackInfo const& info) {
-  return CPPToNapi(info)(buffer().capacity());
+  return CPPToNapi(info)(is_view() ? size() : buffer().capacity());
 }
 
 Napi::Value DeviceBuffer::is_empty(Napi::CallbackInfo const& info) {
-  return CPPToNapi(info)(buffer().is_empty());
+  return CPPToNapi(info)(is_empty());
+}
+
+Napi::Value DeviceBuffer::is_view(Napi::CallbackInfo const& info) {
+  return CPPToNapi(info)(is_view());
 }
 
 Napi::Value DeviceBuffer::ptr(Napi::CallbackInfo const& info) {
@@ -148,6 +265,8 @@ Napi::Value DeviceBuffer::ptr(Napi::CallbackInfo const& info) {
 
 Napi::Value DeviceBuffer::resize(Napi::CallbackInfo const& info) {
   const CallbackArgs args{info};
+  NODE_CUDA_EXPECT(!is_view(), "Cannot resize a DeviceBuffer view", args.Env());
+  NODE_CUDA_EXPECT(num_views() == 0, "Cannot resize a DeviceBuffer with live views", args.Env());
   const size_t new_size = args[0];
   if (args.Length() > 1 && info[1].IsNumber()) {
     cudaStream_t stream = args[1];
@@ -160,6 +279,7 @@ Napi::Value DeviceBuffer::resize(Napi::CallbackInfo const& info) {
 
 Napi::Value DeviceBuffer::set_stream(Napi::CallbackInfo const& info) {
   const CallbackArgs args{info};
+  NODE_CUDA_EXPECT(!is_view(), "Cannot set the stream of a DeviceBuffer view", args.Env());
   const cudaStream_t stream = args[0];
   buffer().set_stream(stream);
   return args.Env().Undefined();
@@ -167,6 +287,8 @@ Napi::Value DeviceBuffer::set_stream(Napi::CallbackInfo const& info) {
 
 Napi::Value DeviceBuffer::shrink_to_fit(Napi::CallbackInfo const& info) {
   const CallbackArgs args{info};
+  NODE_CUDA_EXPECT(!is_view(), "Cannot shrink a DeviceBuffer view", args.Env());
+  NODE_CUDA_EXPECT(num_views() == 0, "Cannot shrink a DeviceBuffer with live views", args.Env());
   const cudaStream_t stream = args[0];
   buffer().shrink_to_fit(stream);
   return args.Env().Undefined();
@@ -185,6 +307,18 @@ Napi::Value DeviceBuffer::slice(Napi::CallbackInfo const& info) {
   return DeviceBuffer::New(static_cast<char*>(data()) + offset, length, mr_.Value(), stream());
 }
 
+Napi::Value DeviceBuffer::view(Napi::CallbackInfo const& info) {
+  auto const env  = info.Env();
+  auto const size = static_cast<double>(this->size());
+  // Check the bounds as doubles, before they can wrap around as size_t
+  double const begin = info.Length() > 0 && info[0].IsNumber() ? info[0].ToNumber() : 0;
+  double const end   = info.Length() > 1 && info[1].IsNumber() ? info[1].ToNumber() : size;
+  NODE_CUDA_EXPECT(0 <= begin && begin <= size, "DeviceBuffer view begin is out of bounds", env);
+  NODE_CUDA_EXPECT(begin <= end && end <= size, "DeviceBuffer view end is out of bounds", env);
+  return DeviceBuffer::View(
+    Value(), static_cast<size_t>(begin), static_cast<size_t>(end) - static_cast<size_t>(begin));
+}
+
 Napi::Value DeviceBuffer::device(Napi::CallbackInfo const& info) { return device(); }
 
 Napi::Value DeviceBuffer::stream(Napi::CallbackInfo const& info) { return stream(); }
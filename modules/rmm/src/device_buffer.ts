@@ -30,6 +30,21 @@ type DeviceBufferInput = BigIntArray|TypedArray|ArrayBufferLike;
 
 export interface DeviceBufferConstructor {
   readonly prototype: DeviceBuffer;
+
+  /**
+   * Copy host memory into a new DeviceBuffer without blocking the JavaScript thread.
+   *
+   * The source is staged through a reusable pool of pinned host buffers in chunks, and each chunk
+   * is copied to the device asynchronously on `stream`. The source is kept alive until the copy
+   * completes, but must not be modified until the returned Promise resolves.
+   *
+   * @param source - the host memory to copy
+   * @param options - the MemoryResource to allocate from and the stream to copy on (optional)
+   * @returns a Promise that resolves with the DeviceBuffer once the copy has completed
+   */
+  fromAsync(source: DeviceBufferInput,
+            options?: {memoryResource?: MemoryResource, stream?: number}): Promise<DeviceBuffer>;
+
   new(byteLength?: number, mr?: MemoryResource, stream?: number): DeviceBuffer;
   new(source?: DeviceBufferInput, mr?: MemoryResource, stream?: number): DeviceBuffer;
   new(sourceOrByteLength?: DeviceBufferInput|number, mr?: MemoryResource, stream?: number):
@@ -40,8 +55,20 @@ export interface DeviceBuffer extends ArrayBuffer {
   readonly byteLength: number;
   readonly capacity: number;
   readonly isEmpty: boolean;
+  /**
+   * Whether this buffer views memory owned by another DeviceBuffer (see `view()`).
+   */
+  readonly isView: boolean;
   readonly ptr: number;
   readonly device: number;
+  /**
+   * The stream on which this buffer was allocated and will be freed.
+   *
+   * Stream-ordered MemoryResources (CudaAsyncMemoryResource, ArenaMemoryResource,
+   * PoolMemoryResource) may hand this buffer's memory to later allocations on the same stream as
+   * soon as the free is enqueued. Work on other streams that reads this buffer must be complete,
+   * or synchronized with this stream, before the buffer is freed or moved with `setStream`.
+   */
   readonly stream: number;
   readonly memoryResource: MemoryResource;
 
@@ -100,6 +127,20 @@ export interface DeviceBuffer extends ArrayBuffer {
    * buffer, if unspecified
    */
   slice(begin: number, end?: number): DeviceBuffer;
+
+  /**
+   * Create a DeviceBuffer that views a range of this buffer's memory, without allocating or
+   * copying.
+   *
+   * The view keeps this buffer alive, and can be used anywhere a DeviceBuffer is accepted. Writes
+   * through the view are visible in this buffer and vice versa. Views can't be resized, and share
+   * the stream of the buffer that owns the memory. The owning buffer can't be resized or shrunk
+   * while it has views that haven't been garbage collected.
+   *
+   * @param begin - the offset (in bytes) of the first byte to view, or 0 if unspecified
+   * @param end - the offset (in bytes) to end the view, or the end of the buffer, if unspecified
+   */
+  view(begin?: number, end?: number): DeviceBuffer;
 }
 
 // eslint-disable-next-line @typescript-eslint/no-redeclare
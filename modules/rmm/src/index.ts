@@ -14,6 +14,7 @@
 
 export * from './device_buffer';
 export * from './memory_resource';
+export * from './replay';
 
 import RMM from './addon';
 import {Device, devices} from '@nvidia/cuda';
@@ -17,8 +17,33 @@
 
 #include <thrust/optional.h>
 
+#include <cuda_runtime_api.h>
+
+#include <thread>
+
 namespace nv {
 
+namespace {
+
+Napi::Object counter_to_object(Napi::Env const& env,
+                               statistics_resource_adaptor::counter const& counter) {
+  auto obj = Napi::Object::New(env);
+  obj.Set("current", Napi::Number::New(env, counter.current));
+  obj.Set("peak", Napi::Number::New(env, counter.peak));
+  obj.Set("total", Napi::Number::New(env, counter.total));
+  return obj;
+}
+
+Napi::Object statistics_to_object(Napi::Env const& env,
+                                  statistics_resource_adaptor::statistics const& stats) {
+  auto obj = Napi::Object::New(env);
+  obj.Set("bytes", counter_to_object(env, stats.bytes));
+  obj.Set("count", counter_to_object(env, stats.count));
+  return obj;
+}
+
+}  // namespace
+
 ConstructorReference MemoryResource::constructor;
 
 Napi::Object MemoryResource::Init(Napi::Env env, Napi::Object exports) {
@@ -34,6 +59,11 @@ Napi::Object MemoryResource::Init(Napi::Env env, Napi::Object exports) {
                      InstanceMethod<&MemoryResource::get_mem_info>("getMemInfo"),
                      InstanceMethod<&MemoryResource::add_bin>("addBin"),
                      InstanceMethod<&MemoryResource::flush>("flush"),
+                     InstanceMethod<&MemoryResource::get_statistics>("getStatistics"),
+                     InstanceMethod<&MemoryResource::reset_peaks>("resetPeaks"),
+                     InstanceAccessor<&MemoryResource::get_tag, &MemoryResource::set_tag>("tag"),
+                     InstanceAccessor<&MemoryResource::get_allocation_limit>("allocationLimit"),
+                     InstanceAccessor<&MemoryResource::get_allocated_bytes>("allocatedBytes"),
                      InstanceAccessor<&MemoryResource::get_file_path>("logFilePath"),
                      InstanceAccessor<&MemoryResource::get_upstream_mr>("memoryResource"),
                    })))
@@ -74,6 +104,43 @@ MemoryResource::MemoryResource(CallbackArgs const& args) : Napi::ObjectWrap<Memo
       break;
     }
 
+    // Host resources aren't tied to a device, so leave device_id_ at -1 rather than querying the
+    // active device, which throws on machines without a GPU.
+    case mr_type::pinned: {
+      mr_.reset(new pinned_host_resource_adaptor());
+      break;
+    }
+
+    case mr_type::new_delete: {
+      mr_.reset(new new_delete_host_resource_adaptor());
+      break;
+    }
+
+    case mr_type::cuda_async: {
+#if CUDART_VERSION >= 11020
+      device_id_                     = Device::active_device_id();
+      size_t const initial_pool_size = arg1.IsNumber() ? arg1 : -1;
+      size_t const release_threshold = arg2.IsNumber() ? arg2 : -1;
+      mr_.reset(new rmm::mr::cuda_async_memory_resource(
+        initial_pool_size == -1uL ? thrust::nullopt : thrust::make_optional(initial_pool_size)));
+      // cuda_async_memory_resource allocates from the device's default pool and sets the
+      // pool's release threshold to the device's total memory. Lower it if requested. The
+      // default pool is shared by every CudaAsyncMemoryResource on the device, so the threshold
+      // set by the most recently constructed one applies to all of them.
+      if (release_threshold != -1uL) {
+        cudaMemPool_t pool;
+        uint64_t threshold = release_threshold;
+        NODE_CUDA_TRY(cudaDeviceGetDefaultMemPool(&pool, device_id_), args.Env());
+        NODE_CUDA_TRY(cudaMemPoolSetAttribute(pool, cudaMemPoolAttrReleaseThreshold, &threshold),
+                      args.Env());
+      }
+#else
+      NODE_CUDA_EXPECT(
+        false, "CudaAsyncMemoryResource requires building with CUDA 11.2 or newer.", args.Env());
+#endif
+      break;
+    }
+
     case mr_type::pool: {
       NODE_CUDA_EXPECT(MemoryResource::is_instance(arg1.val),
                        "PoolMemoryResource constructor expects an upstream MemoryResource from "
@@ -104,6 +171,66 @@ MemoryResource::MemoryResource(CallbackArgs const& args) : Napi::ObjectWrap<Memo
       break;
     }
 
+    case mr_type::arena: {
+      NODE_CUDA_EXPECT(MemoryResource::is_instance(arg1.val),
+                       "ArenaMemoryResource constructor expects an upstream MemoryResource from "
+                       "which to allocate the global arena.",
+                       args.Env());
+      using arena_mr = rmm::mr::arena_memory_resource<rmm::mr::device_memory_resource>;
+      rmm::mr::device_memory_resource* mr = arg1;
+      size_t const initial_size           = arg2.IsNumber() ? arg2 : -1;
+      size_t const maximum_size           = arg3.IsNumber() ? arg3 : -1;
+      upstream_mr_                        = Napi::Persistent(arg1.ToObject());
+      mr_.reset(initial_size == -1uL   ? new arena_mr(mr)
+                : maximum_size == -1uL ? new arena_mr(mr, initial_size)
+                                       : new arena_mr(mr, initial_size, maximum_size));
+      break;
+    }
+
+    case mr_type::failure_callback: {
+      NODE_CUDA_EXPECT(MemoryResource::is_instance(arg1.val),
+                       "FailureCallbackResourceAdaptor constructor expects an upstream "
+                       "MemoryResource.",
+                       args.Env());
+      NODE_CUDA_EXPECT(arg2.IsFunction(),
+                       "FailureCallbackResourceAdaptor constructor expects a callback function.",
+                       args.Env());
+      rmm::mr::device_memory_resource* mr = arg1;
+      uint32_t const max_retries          = arg3.IsNumber() ? arg3 : 1;
+      upstream_mr_                        = Napi::Persistent(arg1.ToObject());
+      failure_callback_                   = Napi::Persistent(arg2.As<Napi::Function>());
+      // Allocations can happen on other threads (e.g. DeviceBuffer.fromAsync), but JS can only be
+      // called on the thread that created this resource. Don't retry allocations on other threads.
+      auto const js_thread = std::this_thread::get_id();
+      mr_.reset(new failure_callback_resource_adaptor(
+        mr,
+        [this, js_thread](std::size_t bytes, uint32_t attempt) {
+          if (std::this_thread::get_id() != js_thread) { return false; }
+          auto env = failure_callback_.Env();
+          Napi::HandleScope scope(env);
+          return failure_callback_
+            .Call({Napi::Number::New(env, bytes), Napi::Number::New(env, attempt)})
+            .ToBoolean()
+            .Value();
+        },
+        max_retries));
+      break;
+    }
+
+    case mr_type::limiting: {
+      NODE_CUDA_EXPECT(MemoryResource::is_instance(arg1.val),
+                       "LimitingResourceAdaptor constructor expects an upstream MemoryResource.",
+                       args.Env());
+      NODE_CUDA_EXPECT(arg2.IsNumber(),
+                       "LimitingResourceAdaptor constructor expects a numeric allocation limit.",
+                       args.Env());
+      rmm::mr::device_memory_resource* mr = arg1;
+      size_t const allocation_limit       = arg2;
+      upstream_mr_                        = Napi::Persistent(arg1.ToObject());
+      mr_.reset(new limiting_resource_adaptor(mr, allocation_limit));
+      break;
+    }
+
     case mr_type::binning: {
       NODE_CUDA_EXPECT(MemoryResource::is_instance(arg1.val),
                        "BinningMemoryResource constructor expects an upstream MemoryResource to "
@@ -150,13 +277,27 @@ MemoryResource::MemoryResource(CallbackArgs const& args) : Napi::ObjectWrap<Memo
         mr, log_file_path, auto_flush));
       break;
     }
+
+    case mr_type::statistics: {
+      NODE_CUDA_EXPECT(MemoryResource::is_instance(arg1.val),
+                       "StatisticsResourceAdaptor constructor expects an upstream MemoryResource.",
+                       args.Env());
+      rmm::mr::device_memory_resource* mr = arg1;
+      bool const track_tags               = arg2.IsBoolean() ? arg2 : false;
+      upstream_mr_                        = Napi::Persistent(arg1.ToObject());
+      mr_.reset(new statistics_resource_adaptor(mr, track_tags));
+      break;
+    }
   }
 };
 
 ValueWrap<int32_t> MemoryResource::device() const {
   switch (type_) {
     case mr_type::cuda:
-    case mr_type::managed: return {Env(), device_id_};
+    case mr_type::managed:
+    case mr_type::pinned:
+    case mr_type::new_delete:
+    case mr_type::cuda_async: return {Env(), device_id_};
     default: return MemoryResource::Unwrap(upstream_mr_.Value())->device();
   }
 }
@@ -197,6 +338,65 @@ void MemoryResource::add_bin(size_t allocation_size,
   }
 }
 
+Napi::Value MemoryResource::statistics() const {
+  auto env = Env();
+  if (type_ != mr_type::statistics) { return env.Undefined(); }
+  auto mr  = get_stats_mr();
+  auto obj = statistics_to_object(env, mr->get_statistics());
+
+  auto const histogram = mr->get_histogram();
+  auto buckets         = Napi::Array::New(env, histogram.size());
+  for (uint32_t i = 0; i < histogram.size(); ++i) {
+    buckets.Set(i, Napi::Number::New(env, histogram[i]));
+  }
+  obj.Set("histogram", buckets);
+
+  if (mr->tracks_tags()) {
+    auto tags = Napi::Object::New(env);
+    for (auto const& tag : mr->get_tag_statistics()) {
+      tags.Set(tag.first, statistics_to_object(env, tag.second));
+    }
+    obj.Set("tags", tags);
+  }
+  return obj;
+}
+
+void MemoryResource::reset_peaks() {
+  if (type_ == mr_type::statistics) { get_stats_mr()->reset_peaks(); }
+}
+
+Napi::Value MemoryResource::get_statistics(Napi::CallbackInfo const& info) { return statistics(); }
+
+void MemoryResource::set_failure_callback(failure_callback_t callback) {
+  if (type_ == mr_type::failure_callback) { get_failure_mr()->set_callback(std::move(callback)); }
+}
+
+Napi::Value MemoryResource::get_allocation_limit(Napi::CallbackInfo const& info) {
+  if (type_ != mr_type::limiting) { return info.Env().Undefined(); }
+  return Napi::Number::New(info.Env(), get_limiting_mr()->get_allocation_limit());
+}
+
+Napi::Value MemoryResource::get_allocated_bytes(Napi::CallbackInfo const& info) {
+  if (type_ != mr_type::limiting) { return info.Env().Undefined(); }
+  return Napi::Number::New(info.Env(), get_limiting_mr()->get_allocated_bytes());
+}
+
+Napi::Value MemoryResource::reset_peaks(Napi::CallbackInfo const& info) {
+  reset_peaks();
+  return info.Env().Undefined();
+}
+
+Napi::Value MemoryResource::get_tag(Napi::CallbackInfo const& info) {
+  if (type_ != mr_type::statistics) { return info.Env().Undefined(); }
+  return Napi::String::New(info.Env(), get_stats_mr()->get_tag());
+}
+
+void MemoryResource::set_tag(Napi::CallbackInfo const& info, Napi::Value const& value) {
+  if (type_ == mr_type::statistics) {
+    get_stats_mr()->set_tag(value.IsString() ? value.ToString().Utf8Value() : "");
+  }
+}
+
 Napi::Value MemoryResource::flush(Napi::CallbackInfo const& info) {
   if (type_ == mr_type::logging) { flush(); }
   return info.Env().Undefined();
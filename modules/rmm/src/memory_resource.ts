@@ -16,18 +16,30 @@ import RMM from './addon';
 
 const enum MemoryResourceType
 {
-  CUDA      = 0,
-  MANAGED   = 1,
-  POOL      = 2,
-  FIXEDSIZE = 3,
-  BINNING   = 4,
-  LOGGING   = 5,
+  CUDA       = 0,
+  MANAGED    = 1,
+  POOL       = 2,
+  FIXEDSIZE  = 3,
+  BINNING    = 4,
+  LOGGING    = 5,
+  PINNED     = 6,
+  NEW_DELETE = 7,
+  STATISTICS = 8,
+  CUDA_ASYNC = 9,
+  ARENA      = 10,
+  FAILURE_CALLBACK = 11,
+  LIMITING         = 12,
 }
 
 interface MemoryResourceConstructor {
   readonly prototype: MemoryResource;
   new(type: MemoryResourceType.CUDA, device?: number): MemoryResource;
   new(type: MemoryResourceType.MANAGED): MemoryResource;
+  new(type: MemoryResourceType.PINNED): MemoryResource;
+  new(type: MemoryResourceType.NEW_DELETE): MemoryResource;
+  new(type: MemoryResourceType.CUDA_ASYNC,
+      initialPoolSize?: number,
+      releaseThreshold?: number): MemoryResource;
   new(type: MemoryResourceType.POOL,
       upstreamMemoryResource: MemoryResource,
       initialPoolSize?: number,
@@ -36,6 +48,10 @@ interface MemoryResourceConstructor {
       upstreamMemoryResource: MemoryResource,
       blockSize?: number,
       blocksToPreallocate?: number): MemoryResource;
+  new(type: MemoryResourceType.ARENA,
+      upstreamMemoryResource: MemoryResource,
+      initialSize?: number,
+      maximumSize?: number): MemoryResource;
   new(type: MemoryResourceType.BINNING,
       upstreamMemoryResource: MemoryResource,
       minSizeExponent?: number,
@@ -44,9 +60,24 @@ interface MemoryResourceConstructor {
       upstreamMemoryResource: MemoryResource,
       logFilePath?: string,
       autoFlush?: boolean): MemoryResource;
+  new(type: MemoryResourceType.FAILURE_CALLBACK,
+      upstreamMemoryResource: MemoryResource,
+      callback: (byteLength: number, attempt: number) => boolean,
+      maxRetries?: number): MemoryResource;
+  new(type: MemoryResourceType.LIMITING,
+      upstreamMemoryResource: MemoryResource,
+      allocationLimit: number): MemoryResource;
+  new(type: MemoryResourceType.STATISTICS,
+      upstreamMemoryResource: MemoryResource,
+      trackTags?: boolean): MemoryResource;
 }
 
 export interface MemoryResource {
+  /**
+   * @summary The ordinal of the device the resource allocates on, or -1 for host memory resources.
+   */
+  readonly device: number;
+
   /**
    * @summary A boolean indicating whether the resource supports use of non-null CUDA streams for
    * allocation/deallocation.
@@ -98,6 +129,56 @@ export class ManagedMemoryResource extends MemoryResource {
   constructor() { super(MemoryResourceType.MANAGED); }
 }
 
+export class PinnedMemoryResource extends MemoryResource {
+  /**
+   * @summary Constructs a MemoryResource which allocates distinct chunks of pinned (page-locked)
+   * host memory. Pinned memory is accessible from the device, and copies to and from it can be
+   * asynchronous.
+   *
+   * Pinned allocations are expensive, so wrap this in a PoolMemoryResource to get a pinned host
+   * pool:
+   * ```typescript
+   * const pinnedPool = new PoolMemoryResource(new PinnedMemoryResource(), 64 * 1024 ** 2);
+   * ```
+   */
+  constructor() { super(MemoryResourceType.PINNED); }
+}
+
+export class NewDeleteMemoryResource extends MemoryResource {
+  /**
+   * @summary Constructs a MemoryResource which allocates pageable host memory with aligned
+   * `new`/`delete`.
+   *
+   * Pageable host memory is not accessible from the device. Use it for host staging buffers, or
+   * as the upstream of PoolMemoryResource, FixedSizeMemoryResource, or BinningMemoryResource to
+   * exercise allocator behavior without allocating device memory.
+   */
+  constructor() { super(MemoryResourceType.NEW_DELETE); }
+}
+
+export class CudaAsyncMemoryResource extends MemoryResource {
+  /**
+   * @summary Constructs a MemoryResource which allocates with `cudaMallocAsync` from the active
+   * device's default CUDA memory pool.
+   *
+   * Allocations and frees are ordered on the stream passed to `DeviceBuffer`, so memory freed on a
+   * stream can be reused by later work on that stream without synchronizing the device, and the
+   * CUDA driver handles reuse across streams. Unlike PoolMemoryResource there is no global mutex
+   * on the allocation path. Requires CUDA 11.2 or newer, and throws if built with an older toolkit.
+   *
+   * Every CudaAsyncMemoryResource on a device shares the device's default pool, so the pool's
+   * release threshold is the one set by the most recently constructed CudaAsyncMemoryResource.
+   *
+   * @param initialPoolSize Bytes to allocate and free at construction to warm up the pool
+   *   (optional).
+   * @param releaseThreshold Bytes the pool may hold before returning freed memory to the OS at the
+   *   next stream synchronization. By default the pool keeps everything it allocates.
+   */
+  constructor(initialPoolSize?: number, releaseThreshold?: number) {
+    super(MemoryResourceType.CUDA_ASYNC, initialPoolSize, releaseThreshold);
+  }
+}
+
 export interface PoolMemoryResource extends MemoryResource {
   /**
    * @summary The MemoryResource from which to allocate blocks for the pool.
@@ -144,6 +225,32 @@ export class FixedSizeMemoryResource extends MemoryResource {
   }
 }
 
+export interface ArenaMemoryResource extends MemoryResource {
+  /**
+   * @summary The MemoryResource from which to allocate the global arena.
+   */
+  readonly memoryResource: MemoryResource;
+}
+
+export class ArenaMemoryResource extends MemoryResource {
+  /**
+   * @summary Constructs a suballocator which gives each stream its own arena of superblocks
+   * carved from a global arena allocated from an upstream MemoryResource.
+   *
+   * Each `DeviceBuffer` allocates from and frees to the arena of its stream, so pipelines on
+   * different streams rarely contend. Memory freed on one stream only returns to the global arena
+   * for use by other streams once a whole superblock is free.
+   *
+   * @param upstreamMemoryResource The MemoryResource from which to allocate the global arena.
+   * @param initialSize Initial size of the global arena in bytes. By default, an
+   *   implementation-defined size is used.
+   * @param maximumSize Maximum size in bytes that the global arena can grow to (optional).
+   */
+  constructor(upstreamMemoryResource: MemoryResource, initialSize?: number, maximumSize?: number) {
+    super(MemoryResourceType.ARENA, upstreamMemoryResource, initialSize, maximumSize);
+  }
+}
+
 export interface BinningMemoryResource extends MemoryResource {
   /**
    * The MemoryResource to use for allocations larger than any of the bins.
@@ -220,3 +327,152 @@ export class LoggingResourceAdapter extends MemoryResource {
     super(MemoryResourceType.LOGGING, upstreamMemoryResource, logFilePath, autoFlush);
   }
 }
+
+/**
+ * @summary A counter of bytes or allocations.
+ */
+export interface AllocationCounter {
+  /** The current value. */
+  current: number;
+  /** The maximum value since construction or the last call to `resetPeaks()`. */
+  peak: number;
+  /** The sum of every increment. */
+  total: number;
+}
+
+export interface AllocationStatistics {
+  /** Bytes allocated. */
+  bytes: AllocationCounter;
+  /** Number of allocations. */
+  count: AllocationCounter;
+}
+
+export interface MemoryResourceStatistics extends AllocationStatistics {
+  /**
+   * The number of allocations of each size. Element `i` counts allocations of (2^(i-1), 2^i]
+   * bytes, and the last element also counts every larger allocation.
+   */
+  histogram: number[];
+  /**
+   * The counters for each tag, if constructed with `trackTags`. Allocations made while the tag is
+   * empty are counted under `""`.
+   */
+  tags?: {[tag: string]: AllocationStatistics};
+}
+
+export interface StatisticsResourceAdaptor extends MemoryResource {
+  /**
+   * The upstream MemoryResource whose allocations are counted.
+   */
+  readonly memoryResource: MemoryResource;
+
+  /**
+   * The tag to which subsequent allocations are attributed when tracking tags.
+   */
+  tag: string;
+
+  /**
+   * @summary Returns a snapshot of the allocation counters.
+   *
+   * The snapshot is a copy, so this is cheap enough to call from a metrics endpoint.
+   */
+  getStatistics(): MemoryResourceStatistics;
+
+  /**
+   * @summary Resets each peak counter to its current value.
+   */
+  resetPeaks(): void;
+}
+
+export class StatisticsResourceAdaptor extends MemoryResource {
+  /**
+   * @summary Constructs a MemoryResource that counts the allocations and deallocations performed
+   * by an upstream MemoryResource.
+   *
+   * Tag allocations by call site to find out which code holds memory:
+   * ```typescript
+   * const mr = new StatisticsResourceAdaptor(new CudaMemoryResource(), true);
+   * mr.tag = 'staging';
+   * const buf = new DeviceBuffer(1024, mr);
+   * mr.tag = '';
+   * mr.getStatistics().tags['staging'].bytes.current; // 1024
+   * ```
+   *
+   * @param upstreamMemoryResource The upstream MemoryResource to count.
+   * @param trackTags If true, also counts allocations for each value of `tag`. This records each
+   *   live allocation, so it is slower than counting totals alone.
+   */
+  constructor(upstreamMemoryResource: MemoryResource, trackTags?: boolean) {
+    super(MemoryResourceType.STATISTICS, upstreamMemoryResource, trackTags);
+  }
+}
+
+export interface FailureCallbackResourceAdaptor extends MemoryResource {
+  /**
+   * The upstream MemoryResource whose failed allocations are retried.
+   */
+  readonly memoryResource: MemoryResource;
+}
+
+export class FailureCallbackResourceAdaptor extends MemoryResource {
+  /**
+   * @summary Constructs a MemoryResource that calls `callback` when an allocation from an upstream
+   * MemoryResource fails, and retries the allocation if `callback` returns true.
+   *
+   * Use the callback to release device memory held by unreachable objects before retrying:
+   * ```typescript
+   * // run node with --expose-gc
+   * const mr = new FailureCallbackResourceAdaptor(new CudaMemoryResource(), () => {
+   *   global.gc();
+   *   return true;
+   * });
+   * ```
+   *
+   * The callback is only called for allocations made on the JavaScript thread. Allocations made
+   * on other threads fail without retrying.
+   *
+   * @param upstreamMemoryResource The upstream MemoryResource to allocate from.
+   * @param callback Called with the size of the failed allocation and the number of retries so
+   *   far. Return true to retry, or false to fail the allocation.
+   * @param maxRetries The maximum number of times to retry each allocation (default 1).
+   */
+  constructor(upstreamMemoryResource: MemoryResource,
+              callback: (byteLength: number, attempt: number) => boolean,
+              maxRetries?: number) {
+    super(MemoryResourceType.FAILURE_CALLBACK, upstreamMemoryResource, callback, maxRetries);
+  }
+}
+
+export interface LimitingResourceAdaptor extends MemoryResource {
+  /**
+   * The upstream MemoryResource to allocate from.
+   */
+  readonly memoryResource: MemoryResource;
+
+  /**
+   * The maximum number of bytes that may be allocated through this MemoryResource at once.
+   */
+  readonly allocationLimit: number;
+
+  /**
+   * The number of bytes currently allocated through this MemoryResource.
+   */
+  readonly allocatedBytes: number;
+}
+
+export class LimitingResourceAdaptor extends MemoryResource {
+  /**
+   * @summary Constructs a MemoryResource that fails allocations which would take the bytes
+   * allocated through it over `allocationLimit`.
+   *
+   * Give each tenant of a shared upstream MemoryResource its own LimitingResourceAdaptor to keep
+   * one tenant from starving the others. `getMemInfo()` reports the bytes left under the limit as
+   * free memory.
+   *
+   * @param upstreamMemoryResource The upstream MemoryResource to allocate from.
+   * @param allocationLimit The maximum number of bytes that may be allocated at once.
+   */
+  constructor(upstreamMemoryResource: MemoryResource, allocationLimit: number) {
+    super(MemoryResourceType.LIMITING, upstreamMemoryResource, allocationLimit);
+  }
+}
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <nv_node/utilities/args.hpp>
+
 #include <rmm/device_buffer.hpp>
 
 #include <napi.h>
@@ -22,5 +24,17 @@ namespace nv {
 
 Napi::Value rmmInit(Napi::CallbackInfo const& info);
 
+/**
+ * @brief Replay the allocations and frees of an RMM allocation log (the CSV written by
+ * `logging_resource_adaptor`) against a MemoryResource.
+ *
+ * Allocations still live at the end of the log are freed after timing stops.
+ *
+ * @param args The log file path, and the MemoryResource to allocate from.
+ * @return An object of event counts, the peak bytes requested, and the time spent in allocate and
+ * deallocate.
+ */
+Napi::Value replay_allocation_log(CallbackArgs const& args);
+
 Napi::Object initModule(Napi::Env env, Napi::Object exports);
 }  // namespace nv
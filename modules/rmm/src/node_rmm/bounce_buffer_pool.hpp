@@ -0,0 +1,111 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <node_cuda/utilities/error.hpp>
+
+#include <cuda_runtime_api.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace nv {
+
+/**
+ * @brief A per-device pool of pinned host chunks used to stage host-to-device copies.
+ *
+ * Copies from pageable host memory are synchronous, so `DeviceBuffer.fromAsync()` copies each
+ * chunk of the source into a pinned chunk, then copies that to the device asynchronously. Each
+ * chunk records an event after its device copy, and isn't handed out again until the event has
+ * completed.
+ *
+ * Chunks are allocated on first use and live for the lifetime of the process.
+ */
+class bounce_buffer_pool {
+ public:
+  static constexpr std::size_t chunk_size = 4 << 20;  ///< Size in bytes of each pinned chunk
+  static constexpr std::size_t num_chunks = 4;        ///< Number of pinned chunks per device
+
+  struct chunk {
+    char* data{nullptr};
+    cudaEvent_t copied{nullptr};  ///< Recorded after the device copy from `data` is enqueued
+  };
+
+  /**
+   * @brief Get the pool for a device. The device must be current on the calling thread.
+   */
+  static bounce_buffer_pool& get(int32_t device_id) {
+    static std::mutex mtx;
+    static std::map<int32_t, std::unique_ptr<bounce_buffer_pool>> pools;
+    std::lock_guard<std::mutex> lock(mtx);
+    auto& pool = pools[device_id];
+    if (pool == nullptr) { pool.reset(new bounce_buffer_pool()); }
+    return *pool;
+  }
+
+  bounce_buffer_pool(bounce_buffer_pool const&) = delete;
+  bounce_buffer_pool& operator=(bounce_buffer_pool const&) = delete;
+
+  /**
+   * @brief Wait for a free chunk whose previous device copy has completed.
+   */
+  chunk* acquire() {
+    chunk* c{nullptr};
+    {
+      std::unique_lock<std::mutex> lock(mtx_);
+      cv_.wait(lock, [&] { return !free_.empty(); });
+      c = free_.back();
+      free_.pop_back();
+    }
+    auto const status = cudaEventSynchronize(c->copied);
+    if (status != cudaSuccess) {
+      release(c);
+      NODE_CUDA_THROW(status);
+    }
+    return c;
+  }
+
+  /**
+   * @brief Return a chunk to the pool after recording its `copied` event.
+   */
+  void release(chunk* c) {
+    {
+      std::lock_guard<std::mutex> lock(mtx_);
+      free_.push_back(c);
+    }
+    cv_.notify_one();
+  }
+
+ private:
+  bounce_buffer_pool() : chunks_(num_chunks) {
+    for (auto& c : chunks_) {
+      NODE_CUDA_TRY(cudaHostAlloc(reinterpret_cast<void**>(&c.data), chunk_size, 0));
+      NODE_CUDA_TRY(cudaEventCreateWithFlags(&c.copied, cudaEventDisableTiming));
+      free_.push_back(&c);
+    }
+  }
+
+  std::mutex mtx_;
+  std::condition_variable cv_;
+  std::vector<chunk> chunks_;
+  std::vector<chunk*> free_;
+};
+
+}  // namespace nv
@@ -29,6 +29,37 @@
 namespace nv {
 
 struct DeviceBuffer : public Napi::ObjectWrap<DeviceBuffer> {
+  /**
+   * @brief A counted share of a DeviceBuffer's memory, released when the Share is destroyed.
+   *
+   * A Share holds the counter rather than the DeviceBuffer, so it can be released from the
+   * holder's finalizer even if the DeviceBuffer has already been finalized.
+   */
+  class Share {
+   public:
+    Share() = default;
+    explicit Share(std::shared_ptr<std::size_t> count) : count_{std::move(count)} { ++*count_; }
+    Share(Share&& other) noexcept = default;
+    Share& operator=(Share&& other) noexcept {
+      reset();
+      count_ = std::move(other.count_);
+      return *this;
+    }
+    Share(Share const&) = delete;
+    Share& operator=(Share const&) = delete;
+    ~Share() { reset(); }
+
+    inline void reset() {
+      if (count_ != nullptr) {
+        --*count_;
+        count_.reset();
+      }
+    }
+
+   private:
+    std::shared_ptr<std::size_t> count_{};
+  };
+
   static Napi::Object Init(Napi::Env env, Napi::Object exports);
 
   /**
@@ -106,6 +137,20 @@ struct DeviceBuffer : public Napi::ObjectWrap<DeviceBuffer> {
     ObjectUnwrap<MemoryResource> const& mr = MemoryResource::Cuda(),
     rmm::cuda_stream_view stream           = rmm::cuda_stream_default);
 
+  /**
+   * @brief Construct a new DeviceBuffer instance that views a range of another DeviceBuffer's
+   * memory without allocating or copying.
+   *
+   * The view keeps a reference to `parent`, and follows the parent's memory if it is reallocated.
+   *
+   * @param parent The DeviceBuffer to view.
+   * @param offset Offset in bytes of the first byte to view.
+   * @param size Number of bytes to view.
+   */
+  static ObjectUnwrap<DeviceBuffer> View(ObjectUnwrap<DeviceBuffer> const& parent,
+                                         size_t const offset,
+                                         size_t const size);
+
   /**
    * @brief Check whether an Napi object is an instance of `DeviceBuffer`.
    *
@@ -141,13 +186,39 @@ struct DeviceBuffer : public Napi::ObjectWrap<DeviceBuffer> {
    */
   void Finalize(Napi::Env env) override;
 
-  inline void* data() const { return buffer_->data(); }
+  inline void* data() const {
+    return is_view() ? static_cast<char*>(parent()->data()) + offset_ : buffer_->data();
+  }
+
+  inline size_t size() const { return is_view() ? size_ : buffer_->size(); }
+
+  inline bool is_empty() const { return size() == 0; }
+
+  /**
+   * @brief Whether this DeviceBuffer views memory owned by another DeviceBuffer.
+   */
+  inline bool is_view() const { return !parent_.IsEmpty(); }
+
+  /**
+   * @brief The number of views of this DeviceBuffer's memory that haven't been garbage collected.
+   * A DeviceBuffer with views can't be resized or shrunk, since that would leave them dangling.
+   */
+  inline std::size_t num_views() const { return *views_; }
 
-  inline size_t size() const { return buffer_->size(); }
+  /**
+   * @brief Take a share of this DeviceBuffer's memory, e.g. for each Column that references it.
+   * Holders use `num_shares()` to tell whether they're its only user.
+   */
+  inline Share share() const { return Share{shares_}; }
 
-  inline bool is_empty() const { return buffer_->is_empty(); }
+  /**
+   * @brief The number of outstanding shares of this DeviceBuffer's memory.
+   */
+  inline std::size_t num_shares() const { return *shares_; }
 
-  inline ValueWrap<rmm::cuda_stream_view> stream() { return {Env(), buffer_->stream()}; }
+  inline ValueWrap<rmm::cuda_stream_view> stream() {
+    return {Env(), is_view() ? parent()->buffer().stream() : buffer_->stream()};
+  }
 
   ValueWrap<int32_t> device() const;
 
@@ -157,11 +228,16 @@ struct DeviceBuffer : public Napi::ObjectWrap<DeviceBuffer> {
 
   inline operator Napi::Value() const { return Value(); }
 
+  /**
+   * @brief Returns a reference to the underlying rmm::device_buffer, e.g. to resize it in place.
+   *
+   * The rmm::device_buffer of a view is always empty.
+   */
+  inline rmm::device_buffer& buffer() const { return *buffer_; }
+
  private:
   static ConstructorReference constructor;
 
-  rmm::device_buffer& buffer() const { return *buffer_; }
-
   Napi::Value get_mr(Napi::CallbackInfo const& info);
   Napi::Value byte_length(Napi::CallbackInfo const& info);
   Napi::Value capacity(Napi::CallbackInfo const& info);
@@ -173,9 +249,21 @@ struct DeviceBuffer : public Napi::ObjectWrap<DeviceBuffer> {
   Napi::Value set_stream(Napi::CallbackInfo const& info);
   Napi::Value shrink_to_fit(Napi::CallbackInfo const& info);
   Napi::Value slice(Napi::CallbackInfo const& info);
+  Napi::Value view(Napi::CallbackInfo const& info);
+
+  static Napi::Value from_async(Napi::CallbackInfo const& info);
+  Napi::Value is_view(Napi::CallbackInfo const& info);
+
+  inline DeviceBuffer* parent() const { return DeviceBuffer::Unwrap(parent_.Value()); }
 
   std::unique_ptr<rmm::device_buffer> buffer_;  ///< Pointer to the underlying rmm::device_buffer
   Napi::ObjectReference mr_;  ///< Reference to the JS MemoryResource used by this device_buffer
+  Napi::ObjectReference parent_;  ///< Reference to the DeviceBuffer this views, if any
+  size_t offset_{0};              ///< Offset in bytes into the parent, if a view
+  size_t size_{0};                ///< Size in bytes of the view, if a view
+  Share parent_view_{};           ///< This view's share of the parent's view count, if a view
+  std::shared_ptr<std::size_t> views_{std::make_shared<std::size_t>(0)};  ///< Live views
+  std::shared_ptr<std::size_t> shares_{std::make_shared<std::size_t>(0)};  ///< Live shares
 };
 
 }  // namespace nv
@@ -0,0 +1,107 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/detail/error.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <utility>
+
+namespace nv {
+
+/**
+ * @brief A callback invoked when an allocation fails.
+ *
+ * @param bytes The size of the failed allocation.
+ * @param attempt The number of retries made so far for this allocation.
+ * @return true to retry the allocation, false to rethrow the allocation failure.
+ */
+using failure_callback_t = std::function<bool(std::size_t bytes, uint32_t attempt)>;
+
+/**
+ * @brief A `device_memory_resource` adaptor that calls a callback when an upstream allocation
+ * fails, and retries the allocation if the callback returns true.
+ *
+ * The callback can free memory (e.g. collect garbage, evict caches, or spill) before the retry.
+ */
+class failure_callback_resource_adaptor final : public rmm::mr::device_memory_resource {
+ public:
+  /**
+   * @brief Construct a new failure callback resource adaptor.
+   *
+   * @param upstream The resource to forward allocations to.
+   * @param callback The callback to invoke when an allocation fails.
+   * @param max_retries The maximum number of times to retry each allocation.
+   */
+  failure_callback_resource_adaptor(rmm::mr::device_memory_resource* upstream,
+                                    failure_callback_t callback,
+                                    uint32_t max_retries)
+    : upstream_{upstream}, callback_{std::move(callback)}, max_retries_{max_retries} {}
+
+  failure_callback_resource_adaptor(failure_callback_resource_adaptor const&) = delete;
+  failure_callback_resource_adaptor& operator=(failure_callback_resource_adaptor const&) = delete;
+
+  rmm::mr::device_memory_resource* get_upstream() const noexcept { return upstream_; }
+
+  bool supports_streams() const noexcept override { return upstream_->supports_streams(); }
+
+  bool supports_get_mem_info() const noexcept override {
+    return upstream_->supports_get_mem_info();
+  }
+
+  /**
+   * @brief Replace the callback, e.g. with a native handler registered by another addon.
+   */
+  void set_callback(failure_callback_t callback) { callback_ = std::move(callback); }
+
+  inline uint32_t max_retries() const noexcept { return max_retries_; }
+
+ private:
+  void* do_allocate(std::size_t bytes, rmm::cuda_stream_view stream) override {
+    for (uint32_t attempt = 0;; ++attempt) {
+      try {
+        return upstream_->allocate(bytes, stream);
+      } catch (std::bad_alloc const&) {
+        if (attempt >= max_retries_ || !callback_ || !callback_(bytes, attempt)) { throw; }
+      }
+    }
+  }
+
+  void do_deallocate(void* ptr, std::size_t bytes, rmm::cuda_stream_view stream) override {
+    upstream_->deallocate(ptr, bytes, stream);
+  }
+
+  bool do_is_equal(rmm::mr::device_memory_resource const& other) const noexcept override {
+    if (this == &other) { return true; }
+    auto cast = dynamic_cast<failure_callback_resource_adaptor const*>(&other);
+    return cast != nullptr ? upstream_->is_equal(*cast->get_upstream())
+                           : upstream_->is_equal(other);
+  }
+
+  std::pair<std::size_t, std::size_t> do_get_mem_info(rmm::cuda_stream_view stream) const override {
+    return upstream_->get_mem_info(stream);
+  }
+
+  rmm::mr::device_memory_resource* upstream_;
+  failure_callback_t callback_;
+  uint32_t max_retries_;
+};
+
+}  // namespace nv
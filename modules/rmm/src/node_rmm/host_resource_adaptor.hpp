@@ -0,0 +1,88 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/host/new_delete_resource.hpp>
+#include <rmm/mr/host/pinned_memory_resource.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace nv {
+
+/**
+ * @brief A `device_memory_resource` that allocates from an RMM host memory resource, so host
+ * memory can back `DeviceBuffer`s and be composed with RMM's pool, fixed-size, and binning
+ * suballocators.
+ *
+ * Pinned host memory is accessible from the device. Pageable host memory (`new_delete_resource`)
+ * is not, so it's only suitable for host staging buffers, or for exercising allocator behavior.
+ *
+ * @tparam HostResource The host memory resource type.
+ */
+template <typename HostResource>
+class host_resource_adaptor final : public rmm::mr::device_memory_resource {
+ public:
+  host_resource_adaptor()                              = default;
+  host_resource_adaptor(host_resource_adaptor const&)  = delete;
+  host_resource_adaptor(host_resource_adaptor&&)       = delete;
+  host_resource_adaptor& operator=(host_resource_adaptor const&) = delete;
+  host_resource_adaptor& operator=(host_resource_adaptor&&) = delete;
+
+  /**
+   * @brief Returns the wrapped host memory resource.
+   */
+  HostResource& host_resource() noexcept { return host_mr_; }
+
+  bool supports_streams() const noexcept override { return false; }
+
+  bool supports_get_mem_info() const noexcept override { return false; }
+
+ private:
+  // Match the alignment of RMM's device allocations
+  static constexpr std::size_t alignment = 256;
+
+  // The device may still be reading pinned memory when it's freed
+  static constexpr bool sync_on_deallocate =
+    std::is_same<HostResource, rmm::mr::pinned_memory_resource>::value;
+
+  void* do_allocate(std::size_t bytes, rmm::cuda_stream_view) override {
+    return host_mr_.allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* ptr, std::size_t bytes, rmm::cuda_stream_view stream) override {
+    if (sync_on_deallocate) { stream.synchronize(); }
+    host_mr_.deallocate(ptr, bytes, alignment);
+  }
+
+  // Host resources are stateless, so adaptors of the same type can free each other's memory
+  bool do_is_equal(rmm::mr::device_memory_resource const& other) const noexcept override {
+    return dynamic_cast<host_resource_adaptor<HostResource> const*>(&other) != nullptr;
+  }
+
+  std::pair<std::size_t, std::size_t> do_get_mem_info(rmm::cuda_stream_view) const override {
+    return {0, 0};
+  }
+
+  HostResource host_mr_{};
+};
+
+using pinned_host_resource_adaptor     = host_resource_adaptor<rmm::mr::pinned_memory_resource>;
+using new_delete_host_resource_adaptor = host_resource_adaptor<rmm::mr::new_delete_resource>;
+
+}  // namespace nv
@@ -0,0 +1,100 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/detail/error.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <utility>
+
+namespace nv {
+
+/**
+ * @brief A `device_memory_resource` adaptor that fails allocations which would take the bytes
+ * allocated through it over a fixed limit, so tenants sharing an upstream resource can't starve
+ * each other.
+ */
+class limiting_resource_adaptor final : public rmm::mr::device_memory_resource {
+ public:
+  /**
+   * @brief Construct a new limiting resource adaptor.
+   *
+   * @param upstream The resource to forward allocations to.
+   * @param allocation_limit The maximum number of bytes that may be allocated at once.
+   */
+  limiting_resource_adaptor(rmm::mr::device_memory_resource* upstream,
+                            std::size_t allocation_limit)
+    : upstream_{upstream}, allocation_limit_{allocation_limit} {}
+
+  limiting_resource_adaptor(limiting_resource_adaptor const&) = delete;
+  limiting_resource_adaptor& operator=(limiting_resource_adaptor const&) = delete;
+
+  rmm::mr::device_memory_resource* get_upstream() const noexcept { return upstream_; }
+
+  bool supports_streams() const noexcept override { return upstream_->supports_streams(); }
+
+  bool supports_get_mem_info() const noexcept override { return true; }
+
+  inline std::size_t get_allocation_limit() const noexcept { return allocation_limit_; }
+
+  inline std::size_t get_allocated_bytes() const noexcept { return allocated_bytes_; }
+
+ private:
+  void* do_allocate(std::size_t bytes, rmm::cuda_stream_view stream) override {
+    auto const prev = allocated_bytes_.fetch_add(bytes);
+    if (prev + bytes > allocation_limit_) {
+      allocated_bytes_ -= bytes;
+      throw rmm::bad_alloc("Allocation of " + std::to_string(bytes) +
+                           " bytes exceeds the limit of " + std::to_string(allocation_limit_) +
+                           " bytes (" + std::to_string(prev) + " bytes allocated)");
+    }
+    try {
+      return upstream_->allocate(bytes, stream);
+    } catch (...) {
+      allocated_bytes_ -= bytes;
+      throw;
+    }
+  }
+
+  void do_deallocate(void* ptr, std::size_t bytes, rmm::cuda_stream_view stream) override {
+    upstream_->deallocate(ptr, bytes, stream);
+    allocated_bytes_ -= bytes;
+  }
+
+  bool do_is_equal(rmm::mr::device_memory_resource const& other) const noexcept override {
+    if (this == &other) { return true; }
+    auto cast = dynamic_cast<limiting_resource_adaptor const*>(&other);
+    return cast != nullptr ? upstream_->is_equal(*cast->get_upstream())
+                           : upstream_->is_equal(other);
+  }
+
+  /**
+   * @brief Returns the bytes left under the limit as free memory, and the limit as total memory.
+   */
+  std::pair<std::size_t, std::size_t> do_get_mem_info(rmm::cuda_stream_view) const override {
+    std::size_t const allocated = allocated_bytes_;
+    return {allocated < allocation_limit_ ? allocation_limit_ - allocated : 0, allocation_limit_};
+  }
+
+  rmm::mr::device_memory_resource* upstream_;
+  std::size_t allocation_limit_;
+  std::atomic<std::size_t> allocated_bytes_{0};
+};
+
+}  // namespace nv
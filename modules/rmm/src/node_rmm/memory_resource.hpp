@@ -14,6 +14,10 @@
 
 #pragma once
 
+#include "failure_callback_resource_adaptor.hpp"
+#include "host_resource_adaptor.hpp"
+#include "limiting_resource_adaptor.hpp"
+#include "statistics_resource_adaptor.hpp"
 #include "utilities/cpp_to_napi.hpp"
 
 #include <node_cuda/device.hpp>
@@ -21,7 +25,9 @@
 #include <nv_node/utilities/wrap.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/arena_memory_resource.hpp>
 #include <rmm/mr/device/binning_memory_resource.hpp>
+#include <rmm/mr/device/cuda_async_memory_resource.hpp>
 #include <rmm/mr/device/cuda_memory_resource.hpp>
 #include <rmm/mr/device/device_memory_resource.hpp>
 #include <rmm/mr/device/fixed_size_memory_resource.hpp>
@@ -50,6 +56,19 @@ struct MemoryResource : public Napi::ObjectWrap<MemoryResource> {
     return constructor.New(mr_type::managed, device_id);
   }
 
+  inline static ObjectUnwrap<MemoryResource> Pinned() {
+    return constructor.New(mr_type::pinned);
+  }
+
+  inline static ObjectUnwrap<MemoryResource> NewDelete() {
+    return constructor.New(mr_type::new_delete);
+  }
+
+  inline static ObjectUnwrap<MemoryResource> CudaAsync(size_t initial_pool_size = -1,
+                                                       size_t release_threshold = -1) {
+    return constructor.New(mr_type::cuda_async, initial_pool_size, release_threshold);
+  }
+
   inline static ObjectUnwrap<MemoryResource> Pool(Napi::Object const& upstream_mr,
                                                   size_t initial_pool_size = -1,
                                                   size_t maximum_pool_size = -1) {
@@ -62,6 +81,12 @@ struct MemoryResource : public Napi::ObjectWrap<MemoryResource> {
     return constructor.New(mr_type::fixedsize, upstream_mr, block_size, blocks_to_preallocate);
   }
 
+  inline static ObjectUnwrap<MemoryResource> Arena(Napi::Object const& upstream_mr,
+                                                   size_t initial_size = -1,
+                                                   size_t maximum_size = -1) {
+    return constructor.New(mr_type::arena, upstream_mr, initial_size, maximum_size);
+  }
+
   inline static ObjectUnwrap<MemoryResource> Binning(Napi::Object const& upstream_mr,
                                                      size_t min_size_exponent = -1,
                                                      size_t max_size_exponent = -1) {
@@ -74,6 +99,22 @@ struct MemoryResource : public Napi::ObjectWrap<MemoryResource> {
     return constructor.New(mr_type::logging, upstream_mr, log_file_path, auto_flush);
   }
 
+  inline static ObjectUnwrap<MemoryResource> Statistics(Napi::Object const& upstream_mr,
+                                                        bool track_tags = false) {
+    return constructor.New(mr_type::statistics, upstream_mr, track_tags);
+  }
+
+  inline static ObjectUnwrap<MemoryResource> FailureCallback(Napi::Object const& upstream_mr,
+                                                             Napi::Function const& callback,
+                                                             uint32_t max_retries = 1) {
+    return constructor.New(mr_type::failure_callback, upstream_mr, callback, max_retries);
+  }
+
+  inline static ObjectUnwrap<MemoryResource> Limiting(Napi::Object const& upstream_mr,
+                                                      size_t allocation_limit) {
+    return constructor.New(mr_type::limiting, upstream_mr, allocation_limit);
+  }
+
   /**
    * @brief Check whether an Napi object is an instance of `MemoryResource`.
    *
@@ -102,7 +143,7 @@ struct MemoryResource : public Napi::ObjectWrap<MemoryResource> {
   /**
    * @brief Get the device id for the MemoryResource.
    *
-   * @return ValueWrap<int32_t> The wrapped Device id
+   * @return ValueWrap<int32_t> The wrapped Device id, or -1 for host memory resources
    */
   ValueWrap<int32_t> device() const;
 
@@ -135,6 +176,26 @@ struct MemoryResource : public Napi::ObjectWrap<MemoryResource> {
    */
   void flush();
 
+  /**
+   * @brief Get a snapshot of the allocation counters of a statistics resource adaptor.
+   *
+   * @return A JS object of current/peak/total bytes and allocations, the allocation size
+   * histogram, and (if tracking tags) the counters for each tag. Undefined for other types.
+   */
+  Napi::Value statistics() const;
+
+  /**
+   * @copydoc nv::statistics_resource_adaptor::reset_peaks()
+   */
+  void reset_peaks();
+
+  /**
+   * @brief Replace the JS callback of a failure callback resource adaptor with a native one.
+   *
+   * @param callback The callback to invoke when an allocation fails.
+   */
+  void set_failure_callback(failure_callback_t callback);
+
   /**
    * @brief Adds a bin of the specified maximum allocation size to this memory resource. If
    * specified, uses bin_resource for allocation for this bin. If not specified, creates and uses a
@@ -163,7 +224,25 @@ struct MemoryResource : public Napi::ObjectWrap<MemoryResource> {
       mr_.get());
   }
 
+  inline statistics_resource_adaptor* get_stats_mr() const {
+    return static_cast<statistics_resource_adaptor*>(mr_.get());
+  }
+
+  inline failure_callback_resource_adaptor* get_failure_mr() const {
+    return static_cast<failure_callback_resource_adaptor*>(mr_.get());
+  }
+
+  inline limiting_resource_adaptor* get_limiting_mr() const {
+    return static_cast<limiting_resource_adaptor*>(mr_.get());
+  }
+
   Napi::Value flush(Napi::CallbackInfo const& info);
+  Napi::Value get_allocation_limit(Napi::CallbackInfo const& info);
+  Napi::Value get_allocated_bytes(Napi::CallbackInfo const& info);
+  Napi::Value reset_peaks(Napi::CallbackInfo const& info);
+  Napi::Value get_statistics(Napi::CallbackInfo const& info);
+  Napi::Value get_tag(Napi::CallbackInfo const& info);
+  void set_tag(Napi::CallbackInfo const& info, Napi::Value const& value);
   Napi::Value add_bin(Napi::CallbackInfo const& info);
   Napi::Value is_equal(Napi::CallbackInfo const& info);
 
@@ -180,6 +259,7 @@ struct MemoryResource : public Napi::ObjectWrap<MemoryResource> {
   mr_type type_{mr_type::cuda};
 
   Napi::ObjectReference upstream_mr_;
+  Napi::FunctionReference failure_callback_;
   std::vector<Napi::ObjectReference> bin_mrs_;
   std::shared_ptr<rmm::mr::device_memory_resource> mr_;
 };
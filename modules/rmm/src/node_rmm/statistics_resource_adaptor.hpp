@@ -0,0 +1,197 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace nv {
+
+/**
+ * @brief A `device_memory_resource` adaptor that counts the allocations made through an upstream
+ * resource: current, peak, and total bytes and allocations, a histogram of allocation sizes, and
+ * optionally the bytes and allocations attributed to each caller-supplied tag.
+ *
+ * Counting is cheap enough to leave on in production, unlike `logging_resource_adaptor`.
+ */
+class statistics_resource_adaptor final : public rmm::mr::device_memory_resource {
+ public:
+  /// The number of histogram buckets. Bucket `i` counts allocations of (2^(i-1), 2^i] bytes.
+  static constexpr std::size_t num_buckets = 48;
+
+  struct counter {
+    int64_t current{0};  ///< The current value
+    int64_t peak{0};     ///< The maximum value since construction or the last `reset_peaks()`
+    int64_t total{0};    ///< The sum of every increment
+
+    inline void add(int64_t n) {
+      current += n;
+      total += n;
+      peak = std::max(peak, current);
+    }
+    inline void sub(int64_t n) { current -= n; }
+  };
+
+  struct statistics {
+    counter bytes{};  ///< Bytes allocated
+    counter count{};  ///< Number of allocations
+  };
+
+  /**
+   * @brief Construct a new statistics resource adaptor.
+   *
+   * @param upstream The resource to forward allocations to.
+   * @param track_tags Whether to attribute each allocation to the current tag.
+   */
+  statistics_resource_adaptor(rmm::mr::device_memory_resource* upstream, bool track_tags)
+    : upstream_{upstream}, track_tags_{track_tags} {}
+
+  statistics_resource_adaptor(statistics_resource_adaptor const&) = delete;
+  statistics_resource_adaptor& operator=(statistics_resource_adaptor const&) = delete;
+
+  rmm::mr::device_memory_resource* get_upstream() const noexcept { return upstream_; }
+
+  bool supports_streams() const noexcept override { return upstream_->supports_streams(); }
+
+  bool supports_get_mem_info() const noexcept override {
+    return upstream_->supports_get_mem_info();
+  }
+
+  inline bool tracks_tags() const noexcept { return track_tags_; }
+
+  /**
+   * @brief Returns a snapshot of the counters for every allocation.
+   */
+  statistics get_statistics() const {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return totals_;
+  }
+
+  /**
+   * @brief Returns a snapshot of the allocation size histogram.
+   */
+  std::array<int64_t, num_buckets> get_histogram() const {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return histogram_;
+  }
+
+  /**
+   * @brief Returns a snapshot of the counters for each tag.
+   */
+  std::map<std::string, statistics> get_tag_statistics() const {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return tags_;
+  }
+
+  /**
+   * @brief Attribute subsequent allocations to `tag`.
+   */
+  void set_tag(std::string const& tag) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    tag_ = tag;
+  }
+
+  std::string get_tag() const {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return tag_;
+  }
+
+  /**
+   * @brief Reset each peak to the current value.
+   */
+  void reset_peaks() {
+    std::lock_guard<std::mutex> lock(mtx_);
+    totals_.bytes.peak = totals_.bytes.current;
+    totals_.count.peak = totals_.count.current;
+    for (auto& tag : tags_) {
+      tag.second.bytes.peak = tag.second.bytes.current;
+      tag.second.count.peak = tag.second.count.current;
+    }
+  }
+
+ private:
+  static inline std::size_t bucket(std::size_t bytes) {
+    if (bytes <= 1) { return 0; }
+    return std::min<std::size_t>(num_buckets - 1, 64 - __builtin_clzll(bytes - 1));
+  }
+
+  void* do_allocate(std::size_t bytes, rmm::cuda_stream_view stream) override {
+    auto ptr = upstream_->allocate(bytes, stream);
+    std::lock_guard<std::mutex> lock(mtx_);
+    totals_.bytes.add(bytes);
+    totals_.count.add(1);
+    ++histogram_[bucket(bytes)];
+    if (track_tags_) {
+      auto& tag = tags_[tag_];
+      tag.bytes.add(bytes);
+      tag.count.add(1);
+      // Overwrite rather than emplace, so a stale entry for a reused pointer can't survive
+      allocations_[ptr] = &tag;
+    }
+    return ptr;
+  }
+
+  // Untracks `ptr` before returning it upstream. Once upstream has it, another thread can be
+  // handed the same pointer, and its allocation must not be erased by this one.
+  void do_deallocate(void* ptr, std::size_t bytes, rmm::cuda_stream_view stream) override {
+    {
+      std::lock_guard<std::mutex> lock(mtx_);
+      totals_.bytes.sub(bytes);
+      totals_.count.sub(1);
+      if (track_tags_) {
+        auto alloc = allocations_.find(ptr);
+        if (alloc != allocations_.end()) {
+          alloc->second->bytes.sub(bytes);
+          alloc->second->count.sub(1);
+          allocations_.erase(alloc);
+        }
+      }
+    }
+    upstream_->deallocate(ptr, bytes, stream);
+  }
+
+  bool do_is_equal(rmm::mr::device_memory_resource const& other) const noexcept override {
+    if (this == &other) { return true; }
+    auto cast = dynamic_cast<statistics_resource_adaptor const*>(&other);
+    return cast != nullptr ? upstream_->is_equal(*cast->get_upstream())
+                           : upstream_->is_equal(other);
+  }
+
+  std::pair<std::size_t, std::size_t> do_get_mem_info(rmm::cuda_stream_view stream) const override {
+    return upstream_->get_mem_info(stream);
+  }
+
+  rmm::mr::device_memory_resource* upstream_;
+  bool track_tags_;
+
+  mutable std::mutex mtx_;
+  statistics totals_{};
+  std::array<int64_t, num_buckets> histogram_{};
+  std::string tag_{};
+  std::map<std::string, statistics> tags_{};  ///< std::map, so pointers to values stay valid
+  std::unordered_map<void*, statistics*> allocations_{};
+};
+
+}  // namespace nv
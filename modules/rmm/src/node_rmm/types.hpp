@@ -25,6 +25,13 @@ enum class mr_type : uint8_t {
   fixedsize,
   binning,
   logging,
+  pinned,
+  new_delete,
+  statistics,
+  cuda_async,
+  arena,
+  failure_callback,
+  limiting,
 };
 
 }
@@ -0,0 +1,222 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "node_rmm/addon.hpp"
+#include "node_rmm/memory_resource.hpp"
+#include "node_rmm/utilities/napi_to_cpp.hpp"
+
+#include <node_cuda/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cuda_runtime_api.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace nv {
+
+namespace {
+
+std::vector<std::string> split_csv_line(std::string const& line) {
+  std::vector<std::string> cols;
+  std::stringstream ss(line);
+  std::string col;
+  while (std::getline(ss, col, ',')) { cols.push_back(col); }
+  return cols;
+}
+
+int32_t column_index(std::vector<std::string> const& header, std::string const& name) {
+  auto it = std::find(header.begin(), header.end(), name);
+  return it == header.end() ? -1 : static_cast<int32_t>(it - header.begin());
+}
+
+// Owns the replayed allocations and streams, so they're returned to the MemoryResource and
+// destroyed even if the replay throws partway through the log.
+struct replay_state {
+  using allocation = std::tuple<void*, size_t, rmm::cuda_stream_view>;
+
+  explicit replay_state(rmm::mr::device_memory_resource* mr) : mr(mr) {}
+  replay_state(replay_state const&) = delete;
+  replay_state& operator=(replay_state const&) = delete;
+  ~replay_state() { release(); }
+
+  // Frees every live allocation, then waits on and destroys every replayed stream. Returns the
+  // first CUDA error, but always releases everything.
+  cudaError_t release() noexcept {
+    for (auto const& alloc : live) {
+      auto const& a = alloc.second;
+      try {
+        mr->deallocate(std::get<0>(a), std::get<1>(a), std::get<2>(a));
+      } catch (...) {}
+    }
+    live.clear();
+    cudaError_t status{cudaSuccess};
+    for (auto const& replayed : streams) {
+      auto const synced    = cudaStreamSynchronize(replayed.second);
+      auto const destroyed = cudaStreamDestroy(replayed.second);
+      if (status == cudaSuccess) { status = synced != cudaSuccess ? synced : destroyed; }
+    }
+    streams.clear();
+    return status;
+  }
+
+  rmm::mr::device_memory_resource* mr;
+  std::unordered_map<uintptr_t, allocation> live;
+  std::unordered_map<uintptr_t, cudaStream_t> streams;
+};
+
+}  // namespace
+
+Napi::Value replay_allocation_log(CallbackArgs const& args) {
+  auto env = args.Env();
+  NODE_CUDA_EXPECT(args[0].IsString(), "replayAllocationLog expects a log file path", env);
+  NODE_CUDA_EXPECT(MemoryResource::is_instance(args[1].val),
+                   "replayAllocationLog expects a MemoryResource to replay against",
+                   env);
+
+  std::string const path              = args[0];
+  rmm::mr::device_memory_resource* mr = args[1];
+
+  std::ifstream log(path);
+  NODE_CUDA_EXPECT(log.is_open(), "replayAllocationLog could not open " + path, env);
+
+  std::string line;
+  std::getline(log, line);
+  auto const header = split_csv_line(line);
+  auto const action = column_index(header, "Action");
+  auto const ptr    = column_index(header, "Pointer");
+  auto const size   = column_index(header, "Size");
+  NODE_CUDA_EXPECT(action > -1 && ptr > -1 && size > -1,
+                   "replayAllocationLog expects an RMM log with Action, Pointer, and Size columns",
+                   env);
+  auto const num_cols = static_cast<size_t>(std::max({action, ptr, size})) + 1;
+  // Logs without a Stream column are replayed on the default stream
+  auto const stream = column_index(header, "Stream");
+
+  // Replay each of the logged process's streams on a stream of its own, so stream-ordered
+  // resources (e.g. PoolMemoryResource) keep the same per-stream free lists they did when the log
+  // was recorded. The default, legacy, and per-thread default streams are replayed as themselves.
+  replay_state state{mr};
+  auto& live    = state.live;
+  auto& streams = state.streams;
+  auto replay_stream = [&](uintptr_t logged) -> rmm::cuda_stream_view {
+    if (logged <= reinterpret_cast<uintptr_t>(cudaStreamPerThread)) {
+      return rmm::cuda_stream_view{reinterpret_cast<cudaStream_t>(logged)};
+    }
+    auto iter = streams.find(logged);
+    if (iter == streams.end()) {
+      cudaStream_t replayed;
+      NODE_CUDA_TRY(cudaStreamCreateWithFlags(&replayed, cudaStreamNonBlocking), env);
+      iter = streams.emplace(logged, replayed).first;
+    }
+    return rmm::cuda_stream_view{iter->second};
+  };
+
+  using clock = std::chrono::steady_clock;
+
+  int64_t allocations{0}, deallocations{0}, failed_allocations{0}, unmatched_deallocations{0};
+  int64_t malformed_lines{0};
+  int64_t current_bytes{0}, peak_bytes{0};
+  clock::duration allocate_time{0}, deallocate_time{0};
+
+  while (std::getline(log, line)) {
+    auto const cols = split_csv_line(line);
+    if (cols.size() < num_cols) {
+      ++malformed_lines;
+      continue;
+    }
+    uintptr_t key{0}, logged_stream{0};
+    size_t bytes{0};
+    try {
+      key   = static_cast<uintptr_t>(std::stoull(cols[ptr], nullptr, 16));
+      bytes = static_cast<size_t>(std::stoull(cols[size]));
+      if (stream > -1 && static_cast<size_t>(stream) < cols.size()) {
+        logged_stream = static_cast<uintptr_t>(std::stoull(cols[stream], nullptr, 16));
+      }
+    } catch (std::exception const&) {
+      ++malformed_lines;  // e.g. a line truncated by a crash
+      continue;
+    }
+    if (cols[action] == "allocate") {
+      // Allocating a pointer that's still live means the log is missing its free
+      if (live.find(key) != live.end()) {
+        ++malformed_lines;
+        continue;
+      }
+      auto const on    = replay_stream(logged_stream);
+      auto const start = clock::now();
+      try {
+        auto p = mr->allocate(bytes, on);
+        allocate_time += clock::now() - start;
+        live.emplace(key, std::make_tuple(p, bytes, on));
+        current_bytes += bytes;
+        peak_bytes = std::max(peak_bytes, current_bytes);
+        ++allocations;
+      } catch (std::bad_alloc const&) {
+        allocate_time += clock::now() - start;
+        ++failed_allocations;
+      } catch (std::exception const& e) {
+        // Anything else (e.g. a CUDA error) ends the replay. `state` releases what was replayed.
+        NAPI_THROW(Napi::Error::New(env, e.what()));
+      }
+    } else if (cols[action] == "free") {
+      auto alloc = live.find(key);
+      if (alloc == live.end()) {
+        ++unmatched_deallocations;
+        continue;
+      }
+      // Untrack it first, so `state` won't free it again if deallocate throws
+      auto const freed = alloc->second;
+      live.erase(alloc);
+      auto const start = clock::now();
+      try {
+        mr->deallocate(std::get<0>(freed), std::get<1>(freed), std::get<2>(freed));
+      } catch (std::exception const& e) { NAPI_THROW(Napi::Error::New(env, e.what())); }
+      deallocate_time += clock::now() - start;
+      current_bytes -= std::get<1>(freed);
+      ++deallocations;
+    }
+  }
+
+  auto const live_at_end = static_cast<int64_t>(live.size());
+  NODE_CUDA_TRY(state.release(), env);
+
+  auto to_ns = [](clock::duration d) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+  };
+
+  auto result = Napi::Object::New(env);
+  result.Set("allocations", Napi::Number::New(env, allocations));
+  result.Set("deallocations", Napi::Number::New(env, deallocations));
+  result.Set("failedAllocations", Napi::Number::New(env, failed_allocations));
+  result.Set("unmatchedDeallocations", Napi::Number::New(env, unmatched_deallocations));
+  result.Set("malformedLines", Napi::Number::New(env, malformed_lines));
+  result.Set("liveAtEnd", Napi::Number::New(env, live_at_end));
+  result.Set("peakBytes", Napi::Number::New(env, peak_bytes));
+  result.Set("allocateNanoseconds", Napi::Number::New(env, to_ns(allocate_time)));
+  result.Set("deallocateNanoseconds", Napi::Number::New(env, to_ns(deallocate_time)));
+  return result;
+}
+
+}  // namespace nv
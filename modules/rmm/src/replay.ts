@@ -0,0 +1,97 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import RMM from './addon';
+import {MemoryResource, StatisticsResourceAdaptor} from './memory_resource';
+
+/**
+ * The counts and timings from replaying an RMM allocation log.
+ */
+export interface ReplayResult {
+  /** The number of allocations replayed. */
+  allocations: number;
+  /** The number of frees replayed. */
+  deallocations: number;
+  /** The number of allocations that failed. */
+  failedAllocations: number;
+  /** The number of frees of pointers that weren't allocated (or failed) in the log. */
+  unmatchedDeallocations: number;
+  /**
+   * The number of lines skipped because they were truncated, couldn't be parsed, or allocated a
+   * pointer that was still live.
+   */
+  malformedLines: number;
+  /** The number of allocations not freed by the end of the log. */
+  liveAtEnd: number;
+  /** The peak number of bytes requested at once. */
+  peakBytes: number;
+  /** Total time spent in allocate, in nanoseconds. */
+  allocateNanoseconds: number;
+  /** Total time spent in deallocate, in nanoseconds. */
+  deallocateNanoseconds: number;
+}
+
+export interface ReplayReport extends ReplayResult {
+  /** Allocations and frees replayed per second of time spent in the MemoryResource. */
+  eventsPerSecond: number;
+  /** The peak number of bytes the MemoryResource held from its upstream MemoryResource. */
+  peakFootprintBytes: number;
+  /**
+   * The fraction of the peak footprint that wasn't requested at the peak: `1 - peakBytes /
+   * peakFootprintBytes`. Includes memory a pool preallocates but never hands out.
+   */
+  fragmentation: number;
+}
+
+/**
+ * @summary Replay the allocations and frees recorded by a LoggingResourceAdapter against a
+ * MemoryResource, and report its throughput, peak footprint, and fragmentation.
+ *
+ * Replay a production trace against candidate configurations to pick pool and binning
+ * parameters. Use a NewDeleteMemoryResource upstream to replay without allocating device memory.
+ * A GPU is still required if the log has non-default streams, or if the replayed MemoryResource
+ * is stream-ordered (e.g. PoolMemoryResource), since those create CUDA streams and events:
+ * ```typescript
+ * const report = replayAllocationLog(
+ *   'rmm_log.csv',
+ *   (upstream) => new PoolMemoryResource(upstream, 256 * 1024 ** 2),
+ *   new NewDeleteMemoryResource());
+ * ```
+ *
+ * Each stream in the log's Stream column is replayed on a stream of its own, so stream-ordered
+ * resources reproduce the logged per-stream reuse. The default streams are replayed as themselves.
+ * Logs without a Stream column are replayed on the default stream.
+ *
+ * @param logFilePath Path to the CSV log written by a LoggingResourceAdapter.
+ * @param createMemoryResource Returns the MemoryResource to replay against, allocating from
+ *   `upstream`.
+ * @param upstream The MemoryResource the replayed MemoryResource allocates from.
+ */
+export function replayAllocationLog(logFilePath: string,
+                                    createMemoryResource: (upstream: MemoryResource) =>
+                                      MemoryResource,
+                                    upstream: MemoryResource): ReplayReport {
+  const stats   = new StatisticsResourceAdaptor(upstream);
+  const mr      = createMemoryResource(stats);
+  const result  = RMM.replayAllocationLog(logFilePath, mr) as ReplayResult;
+  const events  = result.allocations + result.deallocations;
+  const seconds = (result.allocateNanoseconds + result.deallocateNanoseconds) / 1e9;
+  const peak    = stats.getStatistics().bytes.peak;
+  return {
+    ...result,
+    eventsPerSecond: seconds > 0 ? events / seconds : 0,
+    peakFootprintBytes: peak,
+    fragmentation: peak > 0 ? 1 - result.peakBytes / peak : 0,
+  };
+}
@@ -12,7 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-import {DeviceBuffer} from '@nvidia/rmm';
+import {Uint8Buffer} from '@nvidia/cuda';
+import {DeviceBuffer, NewDeleteMemoryResource} from '@nvidia/rmm';
 
 test(`DeviceBuffer empty initialization`, () => {
   const db = new DeviceBuffer(0);
@@ -40,3 +41,47 @@ test(`DeviceBuffer resize`, () => {
   expect(db.capacity).toBe(1234);
   expect(db.isEmpty).toBe(true);
 });
+
+test(`DeviceBuffer view`, () => {
+  const db   = new DeviceBuffer(new Uint8Array([0, 1, 2, 3, 4, 5, 6, 7]));
+  const view = db.view(2, 6);
+  expect(view.isView).toBe(true);
+  expect(view.byteLength).toBe(4);
+  expect(view.ptr).toBe(db.ptr + 2);
+  expect(view.memoryResource).toBe(db.memoryResource);
+
+  const nested = view.view(1);
+  expect(nested.byteLength).toBe(3);
+  expect(nested.ptr).toBe(db.ptr + 3);
+
+  new Uint8Buffer(view).fill(9);
+  expect([...new Uint8Buffer(db).toArray()]).toEqual([0, 1, 9, 9, 9, 9, 6, 7]);
+  expect(() => view.resize(8)).toThrow();
+  // The owner can't be resized out from under its views
+  expect(() => db.resize(16)).toThrow();
+  expect(() => db.shrinkToFit(0)).toThrow();
+});
+
+test(`DeviceBuffer view bounds`, () => {
+  const db = new DeviceBuffer(new Uint8Array(8));
+  expect(() => db.view(9)).toThrow();
+  expect(() => db.view(-1)).toThrow();
+  expect(() => db.view(6, 2)).toThrow();
+  expect(() => db.view(2, 9)).toThrow();
+  expect(db.view(8).byteLength).toBe(0);
+});
+
+test(`DeviceBuffer fromAsync`, async () => {
+  // Larger than one pinned staging chunk, so the copy is split
+  const source = new Uint8Array(5 * (1 << 20)).map((_, i) => i % 251);
+  const db     = await DeviceBuffer.fromAsync(source);
+  expect(db.byteLength).toBe(source.byteLength);
+  expect(new Uint8Buffer(db).toArray()).toEqual(source);
+});
+
+test(`DeviceBuffer fromAsync into host memory`, async () => {
+  const source         = new Uint8Array(1 << 20).map((_, i) => i % 251);
+  const memoryResource = new NewDeleteMemoryResource();
+  const db             = await DeviceBuffer.fromAsync(source, {memoryResource});
+  expect(new Uint8Buffer(db).toArray()).toEqual(source);
+});
@@ -14,7 +14,15 @@
 
 import {expect} from '@jest/globals';
 import {Uint8Buffer} from '@nvidia/cuda';
-import {DeviceBuffer} from '@nvidia/rmm';
+import {
+  BinningMemoryResource,
+  DeviceBuffer,
+  FailureCallbackResourceAdaptor,
+  LimitingResourceAdaptor,
+  NewDeleteMemoryResource,
+  PoolMemoryResource,
+  StatisticsResourceAdaptor,
+} from '@nvidia/rmm';
 import {sizes, testForEachDevice} from '../utils';
 import {memoryResourceTestConfigs} from './utils';
 
@@ -61,3 +69,74 @@ describe.each(memoryResourceTestConfigs)(`%s`, (_, testConfig) => {
     buf = null;
   });
 });
+
+describe('NewDeleteMemoryResource', () => {
+  test(`can be composed with suballocators`, () => {
+    const host = new NewDeleteMemoryResource();
+    const pool = new PoolMemoryResource(host, sizes['1_MiB'], sizes['16_MiB']);
+    const bins = new BinningMemoryResource(pool, 10, 20);
+    expect(host.isEqual(new NewDeleteMemoryResource())).toBe(true);
+    expect(pool.memoryResource).toBe(host);
+    // Pageable host memory isn't accessible from the device, so only allocate and free
+    const lengths                 = [1 << 10, 1 << 15, 1 << 20, sizes['2_MiB']];
+    let bufs: DeviceBuffer[]|null = lengths.map((size) => new DeviceBuffer(size, bins));
+    expect(bufs.map((buf) => buf.byteLength)).toEqual(lengths);
+    // eslint-disable-next-line @typescript-eslint/no-unused-vars
+    bufs = null;
+  });
+
+  test(`isn't tied to a device`, () => {
+    const host = new NewDeleteMemoryResource();
+    expect(host.device).toBe(-1);
+    expect(new DeviceBuffer(1 << 10, host).device).toBe(-1);
+  });
+});
+
+describe('StatisticsResourceAdaptor', () => {
+  test(`counts allocations by size and tag`, () => {
+    const mr      = new StatisticsResourceAdaptor(new NewDeleteMemoryResource(), true);
+    const lengths = [sizes['1_MiB'], sizes['2_MiB']];
+    const bytes   = lengths[0] + lengths[1];
+    mr.tag        = 'a';
+    let a: DeviceBuffer|null = new DeviceBuffer(lengths[0], mr);
+    mr.tag                   = 'b';
+    let b: DeviceBuffer|null = new DeviceBuffer(lengths[1], mr);
+    mr.tag                   = '';
+    expect(mr.tag).toBe('');
+    mr.resetPeaks();
+    const stats = mr.getStatistics();
+    expect(stats.bytes).toEqual({current: bytes, peak: bytes, total: bytes});
+    expect(stats.count).toEqual({current: 2, peak: 2, total: 2});
+    expect(stats.histogram[20]).toBe(1);
+    expect(stats.histogram[21]).toBe(1);
+    expect(stats.tags!['a'].bytes.current).toBe(lengths[0]);
+    expect(stats.tags!['b'].count).toEqual({current: 1, peak: 1, total: 1});
+    expect(a.byteLength + b.byteLength).toBe(bytes);
+    // eslint-disable-next-line @typescript-eslint/no-unused-vars
+    a = b = null;
+  });
+});
+
+describe('LimitingResourceAdaptor', () => {
+  test(`fails allocations over the limit, and retries from a failure callback`, () => {
+    const limit = new LimitingResourceAdaptor(new NewDeleteMemoryResource(), sizes['2_MiB']);
+    let held: DeviceBuffer|null = new DeviceBuffer(sizes['1_MiB'], limit);
+    expect(limit.allocatedBytes).toBe(sizes['1_MiB']);
+    expect(limit.getMemInfo(0)).toEqual([sizes['1_MiB'], sizes['2_MiB']]);
+    expect(() => new DeviceBuffer(sizes['2_MiB'], limit)).toThrow();
+
+    const attempts: number[] = [];
+    const retry              = new FailureCallbackResourceAdaptor(limit, (_, attempt) => {
+      attempts.push(attempt);
+      // Release the held buffer before the second retry
+      if (attempt === 1 && held) {
+        held.resize(0);
+        held.shrinkToFit(0);
+        held = null;
+      }
+      return true;
+    }, 3);
+    expect(new DeviceBuffer(sizes['2_MiB'], retry).byteLength).toBe(sizes['2_MiB']);
+    expect(attempts).toEqual([0, 1]);
+  });
+});
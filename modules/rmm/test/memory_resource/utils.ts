@@ -14,13 +14,19 @@
 
 import {devices} from '@nvidia/cuda';
 import {
+  ArenaMemoryResource,
   BinningMemoryResource,
+  CudaAsyncMemoryResource,
   CudaMemoryResource,
+  FailureCallbackResourceAdaptor,
   FixedSizeMemoryResource,
+  LimitingResourceAdaptor,
   LoggingResourceAdapter,
   ManagedMemoryResource,
   MemoryResource,
+  PinnedMemoryResource,
   PoolMemoryResource,
+  StatisticsResourceAdaptor,
 } from '@nvidia/rmm';
 import {mkdtempSync} from 'fs';
 import * as Path from 'path';
@@ -47,6 +53,13 @@ afterAll(() => {
   });
 });
 
+function supportsCudaAsync() {
+  try {
+    new CudaAsyncMemoryResource();
+    return true;
+  } catch { return false; }
+}
+
 export const memoryResourceTestConfigs = [
   [
     `CudaMemoryResource (no device)`,
@@ -85,6 +98,45 @@ export const memoryResourceTestConfigs = [
         new PoolMemoryResource(new CudaMemoryResource(), sizes['1_MiB'], sizes['16_MiB']),
     }
   ],
+  // CudaAsyncMemoryResource throws when built with CUDA older than 11.2
+  ...(!supportsCudaAsync() ? [] : [[
+       `CudaAsyncMemoryResource`,
+       {
+         comparable: true,
+         supportsStreams: true,
+         supportsGetMemInfo: false,
+         createMemoryResource: () => new CudaAsyncMemoryResource(sizes['1_MiB'], sizes['16_MiB']),
+       }
+     ]]),
+  [
+    `ArenaMemoryResource`,
+    {
+      comparable: false,
+      supportsStreams: true,
+      supportsGetMemInfo: false,
+      createMemoryResource: () =>
+        new ArenaMemoryResource(new CudaMemoryResource(), sizes['16_MiB'], sizes['16_MiB']),
+    }
+  ],
+  [
+    `PinnedMemoryResource`,
+    {
+      comparable: true,
+      supportsStreams: false,
+      supportsGetMemInfo: false,
+      createMemoryResource: () => new PinnedMemoryResource(),
+    }
+  ],
+  [
+    `PoolMemoryResource (pinned upstream)`,
+    {
+      comparable: false,
+      supportsStreams: true,
+      supportsGetMemInfo: false,
+      createMemoryResource: () =>
+        new PoolMemoryResource(new PinnedMemoryResource(), sizes['1_MiB'], sizes['16_MiB']),
+    }
+  ],
   [
     `FixedSizeMemoryResource`,
     {
@@ -115,4 +167,33 @@ export const memoryResourceTestConfigs = [
         new LoggingResourceAdapter(new CudaMemoryResource(), logFilePath, true),
     }
   ],
+  [
+    `StatisticsResourceAdaptor`,
+    {
+      comparable: true,
+      supportsStreams: false,
+      supportsGetMemInfo: true,
+      createMemoryResource: () => new StatisticsResourceAdaptor(new CudaMemoryResource(), true),
+    }
+  ],
+  [
+    `FailureCallbackResourceAdaptor`,
+    {
+      comparable: true,
+      supportsStreams: false,
+      supportsGetMemInfo: true,
+      createMemoryResource: () =>
+        new FailureCallbackResourceAdaptor(new CudaMemoryResource(), () => false),
+    }
+  ],
+  [
+    `LimitingResourceAdaptor`,
+    {
+      comparable: true,
+      supportsStreams: false,
+      supportsGetMemInfo: true,
+      createMemoryResource: () =>
+        new LimitingResourceAdaptor(new CudaMemoryResource(), sizes['16_MiB']),
+    }
+  ],
 ] as [string, TestConfig][];
@@ -0,0 +1,53 @@
+// Copyright (c) 2021, NVIDIA CORPORATION.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import {
+  NewDeleteMemoryResource,
+  PoolMemoryResource,
+  replayAllocationLog,
+} from '@nvidia/rmm';
+import {mkdtempSync, writeFileSync} from 'fs';
+import * as Path from 'path';
+
+import {sizes} from './utils';
+
+test(`replayAllocationLog replays an RMM log against a host-backed pool`, () => {
+  const logFilePath = Path.join(mkdtempSync(Path.join('/tmp', 'node_rmm')), 'log.csv');
+  writeFileSync(logFilePath,
+                [
+                  `Thread,Time,Action,Pointer,Size,Stream`,
+                  `1,12:00:00:000001,allocate,0x7f0000000000,${sizes['1_MiB']},0x0`,
+                  `1,12:00:00:000002,allocate,0x7f0000100000,${sizes['2_MiB']},0x0`,
+                  `1,12:00:00:000003,free,0x7f0000000000,${sizes['1_MiB']},0x0`,
+                  `1,12:00:00:000004,free,0x7f00deadbeef,16,0x0`,
+                  `1,12:00:00:000005,allocate,0x7f0000000000,${sizes['1_MiB']},0x0`,
+                  `2,12:00:00:000006,allocate,0x7f0000300000,${sizes['1_MiB']},0x55d0c0ffee00`,
+                  `2,12:00:00:000007,free,0x7f0000300000,${sizes['1_MiB']},0x55d0c0ffee00`,
+                  `1,12:00:00:000008,allocate,0x7f0000100000,${sizes['2_MiB']},0x0`,
+                  `1,12:00:00:000009,allocate,0x7f00`,
+                ].join('\n'));
+  const report = replayAllocationLog(
+    logFilePath,
+    (upstream) => new PoolMemoryResource(upstream, sizes['4_MiB'], sizes['16_MiB']),
+    new NewDeleteMemoryResource());
+  expect(report.allocations).toBe(4);
+  expect(report.deallocations).toBe(2);
+  expect(report.unmatchedDeallocations).toBe(1);
+  expect(report.failedAllocations).toBe(0);
+  expect(report.malformedLines).toBe(2);
+  expect(report.liveAtEnd).toBe(2);
+  expect(report.peakBytes).toBe(sizes['1_MiB'] * 2 + sizes['2_MiB']);
+  expect(report.peakFootprintBytes).toBeGreaterThanOrEqual(report.peakBytes);
+  expect(report.fragmentation).toBeGreaterThanOrEqual(0);
+});